@@ -14,6 +14,7 @@
 #include "scenes/file/glTF.h"
 #endif
 #include "scenes/test/attributes.h"
+#include "scenes/test/cone_caps.h"
 #include "scenes/test/instanced_cubes.h"
 #include "scenes/test/pbr_spheres.h"
 #include "scenes/test/random_cylinders.h"
@@ -56,6 +57,7 @@ static void init()
     registerScene("test", "random_cylinders", sceneRandomCylinders);
     registerScene("test", "triangle_attributes", sceneAttributes);
     registerScene("test", "pbr_spheres", scenePbrSpheres);
+    registerScene("test", "cone_caps", sceneConeCaps);
   }
 }
 
@@ -0,0 +1,107 @@
+// Copyright 2021-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "cone_caps.h"
+
+namespace anari {
+namespace scenes {
+
+ConeCaps::ConeCaps(anari::Device d) : TestScene(d)
+{
+  m_world = anari::newObject<anari::World>(m_device);
+}
+
+ConeCaps::~ConeCaps()
+{
+  anari::release(m_device, m_world);
+}
+
+std::vector<ParameterInfo> ConeCaps::parameters()
+{
+  return {
+      // clang-format off
+      {makeParameterInfo("radius", "Radius of the cylinders and cone bases", 0.2f)}
+      // clang-format on
+  };
+}
+
+anari::World ConeCaps::world()
+{
+  return m_world;
+}
+
+void ConeCaps::commit()
+{
+  auto d = m_device;
+
+  float radius = getParam<float>("radius", 0.2f);
+
+  if (radius <= 0.f)
+    throw std::runtime_error("'radius' must be > 0.f");
+
+  // One column per 'caps' value and one row per 'capStyle', first for
+  // cylinders and then for cones, each tilted with its second end towards the
+  // default camera so both ends show
+
+  const char *caps[] = {"none", "first", "second", "both"};
+  const char *capStyles[] = {"flat", "round"};
+  const char *geometryTypes[] = {"cylinder", "cone"};
+  const math::float3 colors[] = {{0.8f, 0.3f, 0.2f}, {0.2f, 0.5f, 0.8f}};
+
+  std::vector<anari::Surface> surfaces;
+
+  for (int g = 0; g < 2; g++) {
+    auto mat = anari::newObject<anari::Material>(d, "matte");
+    anari::setParameter(d, mat, "color", colors[g]);
+    anari::commitParameters(d, mat);
+
+    for (int s = 0; s < 2; s++) {
+      for (int c = 0; c < 4; c++) {
+        const math::float3 center(c * 1.f, -(2 * g + s) * 1.f, 0.f);
+        const math::float3 axis(0.3f, 0.2f, -0.3f);
+        math::float3 positions[] = {center - axis, center + axis};
+
+        auto geom = anari::newObject<anari::Geometry>(d, geometryTypes[g]);
+        anari::setParameterArray1D(d, geom, "vertex.position", positions, 2);
+        if (g == 0) {
+          anari::setParameter(d, geom, "radius", radius);
+        } else {
+          float radii[] = {radius, 0.5f * radius};
+          anari::setParameterArray1D(d, geom, "vertex.radius", radii, 2);
+        }
+        anari::setParameter(d, geom, "caps", caps[c]);
+        anari::setParameter(d, geom, "capStyle", capStyles[s]);
+        anari::commitParameters(d, geom);
+
+        auto surface = anari::newObject<anari::Surface>(d);
+        anari::setAndReleaseParameter(d, surface, "geometry", geom);
+        anari::setParameter(d, surface, "material", mat);
+        anari::commitParameters(d, surface);
+
+        surfaces.push_back(surface);
+      }
+    }
+
+    anari::release(d, mat);
+  }
+
+  anari::setParameterArray1D(
+      d, m_world, "surface", surfaces.data(), surfaces.size());
+
+  setDefaultLight(m_world);
+
+  anari::commitParameters(d, m_world);
+
+  // cleanup
+
+  for (auto s : surfaces)
+    anari::release(d, s);
+}
+
+TestScene *sceneConeCaps(anari::Device d)
+{
+  return new ConeCaps(d);
+}
+
+} // namespace scenes
+} // namespace anari
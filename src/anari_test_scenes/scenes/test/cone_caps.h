@@ -0,0 +1,29 @@
+// Copyright 2021-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "../scene.h"
+
+namespace anari {
+namespace scenes {
+
+TestScene *sceneConeCaps(anari::Device d);
+
+struct ConeCaps : public TestScene
+{
+  ConeCaps(anari::Device d);
+  ~ConeCaps();
+
+  std::vector<ParameterInfo> parameters() override;
+
+  anari::World world() override;
+
+  void commit() override;
+
+ private:
+  anari::World m_world{nullptr};
+};
+
+} // namespace scenes
+} // namespace anari
@@ -260,7 +260,22 @@ void HelideDevice::initDevice()
   auto &state = *deviceState();
 
   state.anariDevice = (anari::Device)this;
-  state.embreeDevice = rtcNewDevice(nullptr);
+
+  const auto &ec = state.embreeConfig;
+  std::string config;
+  if (ec.numThreads > 0)
+    config += "threads=" + std::to_string(ec.numThreads) + ",";
+  if (ec.setAffinity)
+    config += "set_affinity=1,";
+  if (ec.isa != "default")
+    config += "isa=" + ec.isa + ",";
+  if (!config.empty())
+    config.pop_back();
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "creating embree device with config '%s'",
+      config.c_str());
+  state.embreeDevice = rtcNewDevice(config.empty() ? nullptr : config.c_str());
 
   if (!state.embreeDevice) {
     reportMessage(ANARI_SEVERITY_ERROR,
@@ -277,6 +292,20 @@ void HelideDevice::initDevice()
       },
       this);
 
+  rtcSetDeviceMemoryMonitorFunction(
+      state.embreeDevice,
+      [](void *userPtr, ptrdiff_t bytes, bool /*post*/) {
+        auto &state = *(HelideGlobalState *)userPtr;
+        const auto used = state.embreeMemoryUsed += bytes;
+        if (bytes <= 0 || state.embreeMemoryLimit == 0
+            || uint64_t(used) <= state.embreeMemoryLimit)
+          return true;
+        // a rejected allocation never happened, so it is not counted
+        state.embreeMemoryUsed -= bytes;
+        return false;
+      },
+      &state);
+
   m_initialized = true;
 }
 
@@ -285,14 +314,44 @@ void HelideDevice::deviceCommitParameters()
   auto &state = *deviceState();
 
   bool allowInvalidSurfaceMaterials = state.allowInvalidSurfaceMaterials;
+  const auto groupBVHDefaults = state.groupBVHDefaults;
+  const auto embreeConfig = state.embreeConfig;
 
   state.allowInvalidSurfaceMaterials =
       getParam<bool>("allowInvalidMaterials", true);
   state.invalidMaterialColor =
       getParam<float4>("invalidMaterialColor", float4(1.f, 0.f, 1.f, 1.f));
+  state.groupBVHDefaults = bvhSettingsFromParams(*this, BVHSettings());
+
+  state.embreeConfig.numThreads = getParam<int>("numThreads", 0);
+  state.embreeConfig.setAffinity = getParam<bool>("setAffinity", false);
+  state.embreeConfig.isa = getParamString("isa", "default");
+  if (state.embreeConfig.isa != "default"
+      && state.embreeConfig.isa != "sse4.2") {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unsupported 'isa' value '%s' on device, the bundled Embree is only "
+        "built for 'sse4.2', using 'default'",
+        state.embreeConfig.isa.c_str());
+    state.embreeConfig.isa = "default";
+  }
+  state.embreeMemoryLimit = getParam<uint64_t>("memoryLimit", 0);
+
+  if (m_initialized
+      && (embreeConfig.numThreads != state.embreeConfig.numThreads
+          || embreeConfig.setAffinity != state.embreeConfig.setAffinity
+          || embreeConfig.isa != state.embreeConfig.isa)) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'numThreads', 'setAffinity' and 'isa' only take effect when set "
+        "before the first object is created on the device");
+  }
 
-  if (allowInvalidSurfaceMaterials != state.allowInvalidSurfaceMaterials)
+  if (allowInvalidSurfaceMaterials != state.allowInvalidSurfaceMaterials
+      || groupBVHDefaults.quality != state.groupBVHDefaults.quality
+      || groupBVHDefaults.flags != state.groupBVHDefaults.flags) {
     state.objectUpdates.lastBLSReconstructSceneRequest = helium::newTimeStamp();
+    state.objectUpdates.lastBLSReconstructAllRequest =
+        state.objectUpdates.lastBLSReconstructSceneRequest;
+  }
 
   helium::BaseDevice::deviceCommitParameters();
 }
@@ -307,6 +366,10 @@ int HelideDevice::deviceGetProperty(
   } else if (prop == "helide" && type == ANARI_BOOL) {
     helium::writeToVoidP(mem, true);
     return 1;
+  } else if (prop == "memoryUsed" && type == ANARI_UINT64) {
+    const auto used = deviceState()->embreeMemoryUsed.load();
+    helium::writeToVoidP(mem, uint64_t(std::max(used, int64_t(0))));
+    return 1;
   }
   return 0;
 }
@@ -9,8 +9,8 @@
 #include <anari/anari.h>
 namespace helide {
 static int subtype_hash(const char *str) {
-   static const uint32_t table[] = {0x80000000u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7a6f0075u,0x6665008eu,0x0u,0x0u,0x0u,0x0u,0x6e6d0095u,0x0u,0x0u,0x0u,0x626100a2u,0x0u,0x737200a7u,0x736500b3u,0x767500d3u,0x0u,0x757000d7u,0x737200f1u,0x6f6e0080u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720083u,0x0u,0x0u,0x0u,0x6d6c0087u,0x66650081u,0x1000082u,0x80000001u,0x77760084u,0x66650085u,0x1000086u,0x80000002u,0x6a690088u,0x6f6e0089u,0x6564008au,0x6665008bu,0x7372008cu,0x100008du,0x80000003u,0x6766008fu,0x62610090u,0x76750091u,0x6d6c0092u,0x75740093u,0x1000094u,0x80000004u,0x62610096u,0x68670097u,0x66650098u,0x34310099u,0x4544009cu,0x4544009eu,0x454400a0u,0x100009du,0x80000005u,0x100009fu,0x80000006u,0x10000a1u,0x80000007u,0x757400a3u,0x757400a4u,0x666500a5u,0x10000a6u,0x80000008u,0x757400a8u,0x696800a9u,0x706f00aau,0x686700abu,0x737200acu,0x626100adu,0x717000aeu,0x696800afu,0x6a6900b0u,0x646300b1u,0x10000b2u,0x80000009u,0x737200c1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6900cbu,0x747300c2u,0x717000c3u,0x666500c4u,0x646300c5u,0x757400c6u,0x6a6900c7u,0x777600c8u,0x666500c9u,0x10000cau,0x8000000au,0x6e6d00ccu,0x6a6900cdu,0x757400ceu,0x6a6900cfu,0x777600d0u,0x666500d1u,0x10000d2u,0x8000000bu,0x626100d4u,0x656400d5u,0x10000d6u,0x8000000cu,0x696800dcu,0x0u,0x0u,0x0u,0x737200e1u,0x666500ddu,0x737200deu,0x666500dfu,0x10000e0u,0x8000000du,0x767500e2u,0x646300e3u,0x757400e4u,0x767500e5u,0x737200e6u,0x666500e7u,0x656400e8u,0x535200e9u,0x666500eau,0x686700ebu,0x767500ecu,0x6d6c00edu,0x626100eeu,0x737200efu,0x10000f0u,0x8000000eu,0x6a6100f2u,0x6f6e00fbu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610118u,0x747300fcu,0x676600fdu,0x706500feu,0x73720109u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720115u,0x4746010au,0x7675010bu,0x6f6e010cu,0x6463010du,0x7574010eu,0x6a69010fu,0x706f0110u,0x6f6e0111u,0x32310112u,0x45440113u,0x1000114u,0x8000000fu,0x6e6d0116u,0x1000117u,0x80000010u,0x6f6e0119u,0x6867011au,0x6d6c011bu,0x6665011cu,0x100011du,0x80000011u};
-   uint32_t cur = 0x75000000u;
+   static const uint32_t table[] = {0x7a6f0012u,0x6665003bu,0x0u,0x0u,0x0u,0x0u,0x6e6d0042u,0x0u,0x0u,0x0u,0x6261004fu,0x0u,0x73720054u,0x73650060u,0x76750080u,0x0u,0x75700084u,0x7372009eu,0x6f6d001du,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720030u,0x0u,0x0u,0x0u,0x6d6c0034u,0x7170001fu,0x6665002eu,0x73720020u,0x66650021u,0x74730022u,0x74730023u,0x66650024u,0x65640025u,0x4a490026u,0x6e6d0027u,0x62610028u,0x68670029u,0x6665002au,0x3332002bu,0x4544002cu,0x100002du,0x80000000u,0x100002fu,0x80000001u,0x77760031u,0x66650032u,0x1000033u,0x80000002u,0x6a690035u,0x6f6e0036u,0x65640037u,0x66650038u,0x73720039u,0x100003au,0x80000003u,0x6766003cu,0x6261003du,0x7675003eu,0x6d6c003fu,0x75740040u,0x1000041u,0x80000004u,0x62610043u,0x68670044u,0x66650045u,0x34310046u,0x45440049u,0x4544004bu,0x4544004du,0x100004au,0x80000005u,0x100004cu,0x80000006u,0x100004eu,0x80000007u,0x75740050u,0x75740051u,0x66650052u,0x1000053u,0x80000008u,0x75740055u,0x69680056u,0x706f0057u,0x68670058u,0x73720059u,0x6261005au,0x7170005bu,0x6968005cu,0x6a69005du,0x6463005eu,0x100005fu,0x80000009u,0x7372006eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690078u,0x7473006fu,0x71700070u,0x66650071u,0x64630072u,0x75740073u,0x6a690074u,0x77760075u,0x66650076u,0x1000077u,0x8000000au,0x6e6d0079u,0x6a69007au,0x7574007bu,0x6a69007cu,0x7776007du,0x6665007eu,0x100007fu,0x8000000bu,0x62610081u,0x65640082u,0x1000083u,0x8000000cu,0x69680089u,0x0u,0x0u,0x0u,0x7372008eu,0x6665008au,0x7372008bu,0x6665008cu,0x100008du,0x8000000du,0x7675008fu,0x64630090u,0x75740091u,0x76750092u,0x73720093u,0x66650094u,0x65640095u,0x53520096u,0x66650097u,0x68670098u,0x76750099u,0x6d6c009au,0x6261009bu,0x7372009cu,0x100009du,0x8000000eu,0x6a61009fu,0x6f6e00a8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626100c5u,0x747300a9u,0x676600aau,0x706500abu,0x737200b6u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737200c2u,0x474600b7u,0x767500b8u,0x6f6e00b9u,0x646300bau,0x757400bbu,0x6a6900bcu,0x706f00bdu,0x6f6e00beu,0x323100bfu,0x454400c0u,0x10000c1u,0x8000000fu,0x6e6d00c3u,0x10000c4u,0x80000010u,0x6f6e00c6u,0x686700c7u,0x6d6c00c8u,0x666500c9u,0x10000cau,0x80000011u};
+   uint32_t cur = 0x75630000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
       uint32_t low = (cur>>16u)&0xFFu;
@@ -31,7 +31,7 @@ static int subtype_hash(const char *str) {
    return -1;
 }
 static int param_hash(const char *str) {
-   static const uint32_t table[] = {0x756c0017u,0x62610089u,0x70610093u,0x6a6100ebu,0x0u,0x736100ffu,0x7365018eu,0x666501a7u,0x6f6401adu,0x0u,0x0u,0x6a69027bu,0x70610280u,0x66610299u,0x767002a4u,0x736f02cbu,0x0u,0x6661031bu,0x7669032cu,0x737203b2u,0x716e03bbu,0x706103cau,0x736f0492u,0x716c0020u,0x6362004fu,0x0u,0x0u,0x0u,0x0u,0x73720071u,0x71700075u,0x7574007au,0x706f0025u,0x0u,0x0u,0x0u,0x69680038u,0x78770026u,0x4a490027u,0x6f6e0028u,0x77760029u,0x6261002au,0x6d6c002bu,0x6a69002cu,0x6564002du,0x4e4d002eu,0x6261002fu,0x75740030u,0x66650031u,0x73720032u,0x6a690033u,0x62610034u,0x6d6c0035u,0x74730036u,0x1000037u,0x80000000u,0x62610039u,0x4e43003au,0x76750045u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f004bu,0x75740046u,0x706f0047u,0x67660048u,0x67660049u,0x100004au,0x80000001u,0x6564004cu,0x6665004du,0x100004eu,0x80000002u,0x6a690050u,0x66650051u,0x6f6e0052u,0x75740053u,0x53430054u,0x706f0064u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610069u,0x6d6c0065u,0x706f0066u,0x73720067u,0x1000068u,0x80000003u,0x6564006au,0x6a69006bu,0x6261006cu,0x6f6e006du,0x6463006eu,0x6665006fu,0x1000070u,0x80000004u,0x62610072u,0x7a790073u,0x1000074u,0x80000005u,0x66650076u,0x64630077u,0x75740078u,0x1000079u,0x80000006u,0x7372007bu,0x6a69007cu,0x6362007du,0x7675007eu,0x7574007fu,0x66650080u,0x34300081u,0x1000085u,0x1000086u,0x1000087u,0x1000088u,0x80000007u,0x80000008u,0x80000009u,0x8000000au,0x6463008au,0x6c6b008bu,0x6867008cu,0x7372008du,0x706f008eu,0x7675008fu,0x6f6e0090u,0x65640091u,0x1000092u,0x8000000bu,0x716d00a2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626100acu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c00e7u,0x666500a6u,0x0u,0x0u,0x747300aau,0x737200a7u,0x626100a8u,0x10000a9u,0x8000000cu,0x10000abu,0x8000000du,0x6f6e00adu,0x6f6e00aeu,0x666500afu,0x6d6c00b0u,0x2f2e00b1u,0x716300b2u,0x706f00c0u,0x666500c5u,0x0u,0x0u,0x0u,0x0u,0x6f6e00cau,0x0u,0x0u,0x0u,0x0u,0x0u,0x636200d4u,0x737200dcu,0x6d6c00c1u,0x706f00c2u,0x737200c3u,0x10000c4u,0x8000000eu,0x717000c6u,0x757400c7u,0x696800c8u,0x10000c9u,0x8000000fu,0x747300cbu,0x757400ccu,0x626100cdu,0x6f6e00ceu,0x646300cfu,0x666500d0u,0x4a4900d1u,0x656400d2u,0x10000d3u,0x80000010u,0x6b6a00d5u,0x666500d6u,0x646300d7u,0x757400d8u,0x4a4900d9u,0x656400dau,0x10000dbu,0x80000011u,0x6a6900ddu,0x6e6d00deu,0x6a6900dfu,0x757400e0u,0x6a6900e1u,0x777600e2u,0x666500e3u,0x4a4900e4u,0x656400e5u,0x10000e6u,0x80000012u,0x706f00e8u,0x737200e9u,0x10000eau,0x80000013u,0x757400f4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737200f7u,0x626100f5u,0x10000f6u,0x80000014u,0x666500f8u,0x646300f9u,0x757400fau,0x6a6900fbu,0x706f00fcu,0x6f6e00fdu,0x10000feu,0x80000015u,0x73720111u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0113u,0x0u,0x0u,0x0u,0x0u,0x0u,0x77760118u,0x0u,0x0u,0x6261011bu,0x1000112u,0x80000016u,0x75740114u,0x66650115u,0x73720116u,0x1000117u,0x80000017u,0x7a790119u,0x100011au,0x80000018u,0x6e6d011cu,0x6665011du,0x4443011eu,0x706f011fu,0x6e6d0120u,0x71700121u,0x6d6c0122u,0x66650123u,0x75740124u,0x6a690125u,0x706f0126u,0x6f6e0127u,0x44430128u,0x62610129u,0x6d6c012au,0x6d6c012bu,0x6362012cu,0x6261012du,0x6463012eu,0x6c6b012fu,0x56000130u,0x80000019u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730186u,0x66650187u,0x73720188u,0x45440189u,0x6261018au,0x7574018bu,0x6261018cu,0x100018du,0x8000001au,0x706f019cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f01a3u,0x6e6d019du,0x6665019eu,0x7574019fu,0x737201a0u,0x7a7901a1u,0x10001a2u,0x8000001bu,0x767501a4u,0x717001a5u,0x10001a6u,0x8000001cu,0x6a6901a8u,0x686701a9u,0x696801aau,0x757401abu,0x10001acu,0x8000001du,0x10001b8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626101b9u,0x77410215u,0x8000001eu,0x686701bau,0x666501bbu,0x530001bcu,0x8000001fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665020fu,0x68670210u,0x6a690211u,0x706f0212u,0x6f6e0213u,0x1000214u,0x80000020u,0x7574024bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x67660254u,0x0u,0x0u,0x0u,0x0u,0x7372025au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740263u,0x0u,0x0u,0x62610269u,0x7574024cu,0x7372024du,0x6a69024eu,0x6362024fu,0x76750250u,0x75740251u,0x66650252u,0x1000253u,0x80000021u,0x67660255u,0x74730256u,0x66650257u,0x75740258u,0x1000259u,0x80000022u,0x6261025bu,0x6f6e025cu,0x7473025du,0x6766025eu,0x706f025fu,0x73720260u,0x6e6d0261u,0x1000262u,0x80000023u,0x62610264u,0x6f6e0265u,0x64630266u,0x66650267u,0x1000268u,0x80000024u,0x6d6c026au,0x6a69026bu,0x6564026cu,0x4e4d026du,0x6261026eu,0x7574026fu,0x66650270u,0x73720271u,0x6a690272u,0x62610273u,0x6d6c0274u,0x44430275u,0x706f0276u,0x6d6c0277u,0x706f0278u,0x73720279u,0x100027au,0x80000025u,0x6867027cu,0x6968027du,0x7574027eu,0x100027fu,0x80000026u,0x7574028fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640296u,0x66650290u,0x73720291u,0x6a690292u,0x62610293u,0x6d6c0294u,0x1000295u,0x80000027u,0x66650297u,0x1000298u,0x80000028u,0x6e6d029eu,0x0u,0x0u,0x0u,0x626102a1u,0x6665029fu,0x10002a0u,0x80000029u,0x737202a2u,0x10002a3u,0x8000002au,0x626102aau,0x0u,0x6a6902b0u,0x0u,0x0u,0x757402b5u,0x646302abu,0x6a6902acu,0x757402adu,0x7a7902aeu,0x10002afu,0x8000002bu,0x686702b1u,0x6a6902b2u,0x6f6e02b3u,0x10002b4u,0x8000002cu,0x554f02b6u,0x676602bcu,0x0u,0x0u,0x0u,0x0u,0x737202c2u,0x676602bdu,0x747302beu,0x666502bfu,0x757402c0u,0x10002c1u,0x8000002du,0x626102c3u,0x6f6e02c4u,0x747302c5u,0x676602c6u,0x706f02c7u,0x737202c8u,0x6e6d02c9u,0x10002cau,0x8000002eu,0x747302cfu,0x0u,0x0u,0x6a6902d6u,0x6a6902d0u,0x757402d1u,0x6a6902d2u,0x706f02d3u,0x6f6e02d4u,0x10002d5u,0x8000002fu,0x6e6d02d7u,0x6a6902d8u,0x757402d9u,0x6a6902dau,0x777602dbu,0x666502dcu,0x2f2e02ddu,0x736102deu,0x757402f0u,0x0u,0x706f0300u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640305u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610315u,0x757402f1u,0x737202f2u,0x6a6902f3u,0x636202f4u,0x767502f5u,0x757402f6u,0x666502f7u,0x343002f8u,0x10002fcu,0x10002fdu,0x10002feu,0x10002ffu,0x80000030u,0x80000031u,0x80000032u,0x80000033u,0x6d6c0301u,0x706f0302u,0x73720303u,0x1000304u,0x80000034u,0x1000310u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640311u,0x80000035u,0x66650312u,0x79780313u,0x1000314u,0x80000036u,0x65640316u,0x6a690317u,0x76750318u,0x74730319u,0x100031au,0x80000037u,0x65640320u,0x0u,0x0u,0x0u,0x6f6e0325u,0x6a690321u,0x76750322u,0x74730323u,0x1000324u,0x80000038u,0x65640326u,0x66650327u,0x73720328u,0x66650329u,0x7372032au,0x100032bu,0x80000039u,0x7b7a0339u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261033cu,0x0u,0x0u,0x0u,0x62610342u,0x737203acu,0x6665033au,0x100033bu,0x8000003au,0x6463033du,0x6a69033eu,0x6f6e033fu,0x68670340u,0x1000341u,0x8000003bu,0x75740343u,0x76750344u,0x74730345u,0x44430346u,0x62610347u,0x6d6c0348u,0x6d6c0349u,0x6362034au,0x6261034bu,0x6463034cu,0x6c6b034du,0x5600034eu,0x8000003cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747303a4u,0x666503a5u,0x737203a6u,0x454403a7u,0x626103a8u,0x757403a9u,0x626103aau,0x10003abu,0x8000003du,0x676603adu,0x626103aeu,0x646303afu,0x666503b0u,0x10003b1u,0x8000003eu,0x626103b3u,0x6f6e03b4u,0x747303b5u,0x676603b6u,0x706f03b7u,0x737203b8u,0x6e6d03b9u,0x10003bau,0x8000003fu,0x6a6903beu,0x0u,0x10003c9u,0x757403bfu,0x454403c0u,0x6a6903c1u,0x747303c2u,0x757403c3u,0x626103c4u,0x6f6e03c5u,0x646303c6u,0x666503c7u,0x10003c8u,0x80000040u,0x80000041u,0x6d6c03d9u,0x0u,0x0u,0x0u,0x73720434u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c048du,0x767503dau,0x666503dbu,0x530003dcu,0x80000042u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261042fu,0x6f6e0430u,0x68670431u,0x66650432u,0x1000433u,0x80000043u,0x75740435u,0x66650436u,0x79780437u,0x2f2e0438u,0x75610439u,0x7574044du,0x0u,0x7061045du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0472u,0x0u,0x706f0478u,0x0u,0x62610480u,0x0u,0x62610486u,0x7574044eu,0x7372044fu,0x6a690450u,0x63620451u,0x76750452u,0x75740453u,0x66650454u,0x34300455u,0x1000459u,0x100045au,0x100045bu,0x100045cu,0x80000044u,0x80000045u,0x80000046u,0x80000047u,0x7170046cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c046eu,0x100046du,0x80000048u,0x706f046fu,0x73720470u,0x1000471u,0x80000049u,0x73720473u,0x6e6d0474u,0x62610475u,0x6d6c0476u,0x1000477u,0x8000004au,0x74730479u,0x6a69047au,0x7574047bu,0x6a69047cu,0x706f047du,0x6f6e047eu,0x100047fu,0x8000004bu,0x65640481u,0x6a690482u,0x76750483u,0x74730484u,0x1000485u,0x8000004cu,0x6f6e0487u,0x68670488u,0x66650489u,0x6f6e048au,0x7574048bu,0x100048cu,0x8000004du,0x7675048eu,0x6e6d048fu,0x66650490u,0x1000491u,0x8000004eu,0x73720496u,0x0u,0x0u,0x6261049au,0x6d6c0497u,0x65640498u,0x1000499u,0x8000004fu,0x7170049bu,0x4e4d049cu,0x706f049du,0x6564049eu,0x6665049fu,0x343104a0u,0x10004a3u,0x10004a4u,0x10004a5u,0x80000050u,0x80000051u,0x80000052u};
+   static const uint32_t table[] = {0x75630017u,0x776100acu,0x706100feu,0x6a61017bu,0x0u,0x7361018fu,0x73650226u,0x6665023fu,0x74640245u,0x6a69031au,0x0u,0x6a610320u,0x70610332u,0x76610355u,0x76700379u,0x736903fdu,0x0u,0x6661046eu,0x7661047fu,0x73690522u,0x716e0555u,0x70610564u,0x736f0641u,0x64630029u,0x62610034u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x716c0043u,0x63620072u,0x0u,0x0u,0x0u,0x0u,0x73720094u,0x71700098u,0x7574009du,0x7675002au,0x6e6d002bu,0x7675002cu,0x6d6c002du,0x6261002eu,0x7574002fu,0x6a690030u,0x706f0031u,0x6f6e0032u,0x1000033u,0x80000000u,0x71700035u,0x75740036u,0x6a690037u,0x77760038u,0x66650039u,0x5453003au,0x6261003bu,0x6e6d003cu,0x7170003du,0x6d6c003eu,0x6a69003fu,0x6f6e0040u,0x68670041u,0x1000042u,0x80000001u,0x706f0048u,0x0u,0x0u,0x0u,0x6968005bu,0x78770049u,0x4a49004au,0x6f6e004bu,0x7776004cu,0x6261004du,0x6d6c004eu,0x6a69004fu,0x65640050u,0x4e4d0051u,0x62610052u,0x75740053u,0x66650054u,0x73720055u,0x6a690056u,0x62610057u,0x6d6c0058u,0x74730059u,0x100005au,0x80000002u,0x6261005cu,0x4e43005du,0x76750068u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f006eu,0x75740069u,0x706f006au,0x6766006bu,0x6766006cu,0x100006du,0x80000003u,0x6564006fu,0x66650070u,0x1000071u,0x80000004u,0x6a690073u,0x66650074u,0x6f6e0075u,0x75740076u,0x53430077u,0x706f0087u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261008cu,0x6d6c0088u,0x706f0089u,0x7372008au,0x100008bu,0x80000005u,0x6564008du,0x6a69008eu,0x6261008fu,0x6f6e0090u,0x64630091u,0x66650092u,0x1000093u,0x80000006u,0x62610095u,0x7a790096u,0x1000097u,0x80000007u,0x66650099u,0x6463009au,0x7574009bu,0x100009cu,0x80000008u,0x7372009eu,0x6a69009fu,0x636200a0u,0x767500a1u,0x757400a2u,0x666500a3u,0x343000a4u,0x10000a8u,0x10000a9u,0x10000aau,0x10000abu,0x80000009u,0x8000000au,0x8000000bu,0x8000000cu,0x646300c2u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x696800cbu,0x6c6b00c3u,0x686700c4u,0x737200c5u,0x706f00c6u,0x767500c7u,0x6f6e00c8u,0x656400c9u,0x10000cau,0x8000000du,0x2f2e00ccu,0x736200cdu,0x767500deu,0x706f00eau,0x7a7900f1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f00f8u,0x6a6900dfu,0x6d6c00e0u,0x656400e1u,0x525100e2u,0x767500e3u,0x626100e4u,0x6d6c00e5u,0x6a6900e6u,0x757400e7u,0x7a7900e8u,0x10000e9u,0x8000000eu,0x6e6d00ebu,0x717000ecu,0x626100edu,0x646300eeu,0x757400efu,0x10000f0u,0x8000000fu,0x6f6e00f2u,0x626100f3u,0x6e6d00f4u,0x6a6900f5u,0x646300f6u,0x10000f7u,0x80000010u,0x636200f9u,0x767500fau,0x747300fbu,0x757400fcu,0x10000fdu,0x80000011u,0x716d010du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261013cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0177u,0x66650111u,0x0u,0x0u,0x74530115u,0x73720112u,0x62610113u,0x1000114u,0x80000012u,0x75740136u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x100013bu,0x7a790137u,0x6d6c0138u,0x66650139u,0x100013au,0x80000013u,0x80000014u,0x6f6e013du,0x6f6e013eu,0x6665013fu,0x6d6c0140u,0x2f2e0141u,0x71630142u,0x706f0150u,0x66650155u,0x0u,0x0u,0x0u,0x0u,0x6f6e015au,0x0u,0x0u,0x0u,0x0u,0x0u,0x63620164u,0x7372016cu,0x6d6c0151u,0x706f0152u,0x73720153u,0x1000154u,0x80000015u,0x71700156u,0x75740157u,0x69680158u,0x1000159u,0x80000016u,0x7473015bu,0x7574015cu,0x6261015du,0x6f6e015eu,0x6463015fu,0x66650160u,0x4a490161u,0x65640162u,0x1000163u,0x80000017u,0x6b6a0165u,0x66650166u,0x64630167u,0x75740168u,0x4a490169u,0x6564016au,0x100016bu,0x80000018u,0x6a69016du,0x6e6d016eu,0x6a69016fu,0x75740170u,0x6a690171u,0x77760172u,0x66650173u,0x4a490174u,0x65640175u,0x1000176u,0x80000019u,0x706f0178u,0x73720179u,0x100017au,0x8000001au,0x75740184u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x73720187u,0x62610185u,0x1000186u,0x8000001bu,0x66650188u,0x64630189u,0x7574018au,0x6a69018bu,0x706f018cu,0x6f6e018du,0x100018eu,0x8000001cu,0x737201a1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c01a3u,0x0u,0x0u,0x0u,0x0u,0x0u,0x777201a8u,0x0u,0x0u,0x626101b3u,0x10001a2u,0x8000001du,0x757401a4u,0x666501a5u,0x737201a6u,0x10001a7u,0x8000001eu,0x6e6d01adu,0x0u,0x0u,0x0u,0x7a7901b1u,0x626101aeu,0x757401afu,0x10001b0u,0x8000001fu,0x10001b2u,0x80000020u,0x6e6d01b4u,0x666501b5u,0x444301b6u,0x706f01b7u,0x6e6d01b8u,0x717001b9u,0x6d6c01bau,0x666501bbu,0x757401bcu,0x6a6901bdu,0x706f01beu,0x6f6e01bfu,0x444301c0u,0x626101c1u,0x6d6c01c2u,0x6d6c01c3u,0x636201c4u,0x626101c5u,0x646301c6u,0x6c6b01c7u,0x560001c8u,0x80000021u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473021eu,0x6665021fu,0x73720220u,0x45440221u,0x62610222u,0x75740223u,0x62610224u,0x1000225u,0x80000022u,0x706f0234u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f023bu,0x6e6d0235u,0x66650236u,0x75740237u,0x73720238u,0x7a790239u,0x100023au,0x80000023u,0x7675023cu,0x7170023du,0x100023eu,0x80000024u,0x6a690240u,0x68670241u,0x69680242u,0x75740243u,0x1000244u,0x80000025u,0x1000255u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610256u,0x774102b2u,0x0u,0x0u,0x0u,0x0u,0x62610318u,0x80000026u,0x68670257u,0x66650258u,0x53000259u,0x80000027u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x666502acu,0x686702adu,0x6a6902aeu,0x706f02afu,0x6f6e02b0u,0x10002b1u,0x80000028u,0x757402e8u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x676602f1u,0x0u,0x0u,0x0u,0x0u,0x737202f7u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740300u,0x0u,0x0u,0x62610306u,0x757402e9u,0x737202eau,0x6a6902ebu,0x636202ecu,0x767502edu,0x757402eeu,0x666502efu,0x10002f0u,0x80000029u,0x676602f2u,0x747302f3u,0x666502f4u,0x757402f5u,0x10002f6u,0x8000002au,0x626102f8u,0x6f6e02f9u,0x747302fau,0x676602fbu,0x706f02fcu,0x737202fdu,0x6e6d02feu,0x10002ffu,0x8000002bu,0x62610301u,0x6f6e0302u,0x64630303u,0x66650304u,0x1000305u,0x8000002cu,0x6d6c0307u,0x6a690308u,0x65640309u,0x4e4d030au,0x6261030bu,0x7574030cu,0x6665030du,0x7372030eu,0x6a69030fu,0x62610310u,0x6d6c0311u,0x44430312u,0x706f0313u,0x6d6c0314u,0x706f0315u,0x73720316u,0x1000317u,0x8000002du,0x1000319u,0x8000002eu,0x7574031bu,0x7574031cu,0x6665031du,0x7372031eu,0x100031fu,0x8000002fu,0x7a790329u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6867032eu,0x706f032au,0x7675032bu,0x7574032cu,0x100032du,0x80000030u,0x6968032fu,0x75740330u,0x1000331u,0x80000031u,0x75740341u,0x0u,0x0u,0x0u,0x6e6d0348u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640352u,0x66650342u,0x73720343u,0x6a690344u,0x62610345u,0x6d6c0346u,0x1000347u,0x80000032u,0x706f0349u,0x7372034au,0x7a79034bu,0x4d4c034cu,0x6a69034du,0x6e6d034eu,0x6a69034fu,0x75740350u,0x1000351u,0x80000033u,0x66650353u,0x1000354u,0x80000034u,0x6e6d036au,0x0u,0x0u,0x0u,0x6261036du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6e6d0370u,0x6665036bu,0x100036cu,0x80000035u,0x7372036eu,0x100036fu,0x80000036u,0x55540371u,0x69680372u,0x73720373u,0x66650374u,0x62610375u,0x65640376u,0x74730377u,0x1000378u,0x80000037u,0x6261037fu,0x0u,0x6a6903e2u,0x0u,0x0u,0x757403e7u,0x64630380u,0x6a690381u,0x75740382u,0x7a790383u,0x55000384u,0x80000038u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x696803d9u,0x737203dau,0x666503dbu,0x747303dcu,0x696803ddu,0x706f03deu,0x6d6c03dfu,0x656403e0u,0x10003e1u,0x80000039u,0x686703e3u,0x6a6903e4u,0x6f6e03e5u,0x10003e6u,0x8000003au,0x554f03e8u,0x676603eeu,0x0u,0x0u,0x0u,0x0u,0x737203f4u,0x676603efu,0x747303f0u,0x666503f1u,0x757403f2u,0x10003f3u,0x8000003bu,0x626103f5u,0x6f6e03f6u,0x747303f7u,0x676603f8u,0x706f03f9u,0x737203fau,0x6e6d03fbu,0x10003fcu,0x8000003cu,0x79780407u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730412u,0x0u,0x0u,0x6a650419u,0x66650408u,0x6d6c0409u,0x5453040au,0x6261040bu,0x6e6d040cu,0x7170040du,0x6d6c040eu,0x6665040fu,0x74730410u,0x1000411u,0x8000003du,0x6a690413u,0x75740414u,0x6a690415u,0x706f0416u,0x6f6e0417u,0x1000418u,0x8000003eu,0x6a69041eu,0x0u,0x0u,0x0u,0x6e6d042au,0x6f6e041fu,0x75740420u,0x66650421u,0x68670422u,0x73720423u,0x62610424u,0x75740425u,0x6a690426u,0x706f0427u,0x6f6e0428u,0x1000429u,0x8000003fu,0x6a69042bu,0x7574042cu,0x6a69042du,0x7776042eu,0x6665042fu,0x2f2e0430u,0x73610431u,0x75740443u,0x0u,0x706f0453u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640458u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610468u,0x75740444u,0x73720445u,0x6a690446u,0x63620447u,0x76750448u,0x75740449u,0x6665044au,0x3430044bu,0x100044fu,0x1000450u,0x1000451u,0x1000452u,0x80000040u,0x80000041u,0x80000042u,0x80000043u,0x6d6c0454u,0x706f0455u,0x73720456u,0x1000457u,0x80000044u,0x1000463u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x65640464u,0x80000045u,0x66650465u,0x79780466u,0x1000467u,0x80000046u,0x65640469u,0x6a69046au,0x7675046bu,0x7473046cu,0x100046du,0x80000047u,0x65640473u,0x0u,0x0u,0x0u,0x6f6e0478u,0x6a690474u,0x76750475u,0x74730476u,0x1000477u,0x80000048u,0x65640479u,0x6665047au,0x7372047bu,0x6665047cu,0x7372047du,0x100047eu,0x80000049u,0x6e6d0494u,0x0u,0x0u,0x0u,0x7574049fu,0x0u,0x0u,0x0u,0x7b7a04a9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626104acu,0x0u,0x0u,0x0u,0x626104b2u,0x7372051cu,0x71700495u,0x6d6c0496u,0x6a690497u,0x6f6e0498u,0x68670499u,0x5352049au,0x6261049bu,0x7574049cu,0x6665049du,0x100049eu,0x8000004au,0x424104a0u,0x676604a1u,0x676604a2u,0x6a6904a3u,0x6f6e04a4u,0x6a6904a5u,0x757404a6u,0x7a7904a7u,0x10004a8u,0x8000004bu,0x666504aau,0x10004abu,0x8000004cu,0x646304adu,0x6a6904aeu,0x6f6e04afu,0x686704b0u,0x10004b1u,0x8000004du,0x757404b3u,0x767504b4u,0x747304b5u,0x444304b6u,0x626104b7u,0x6d6c04b8u,0x6d6c04b9u,0x636204bau,0x626104bbu,0x646304bcu,0x6c6b04bdu,0x560004beu,0x8000004eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x74730514u,0x66650515u,0x73720516u,0x45440517u,0x62610518u,0x75740519u,0x6261051au,0x100051bu,0x8000004fu,0x6766051du,0x6261051eu,0x6463051fu,0x66650520u,0x1000521u,0x80000050u,0x6e6c052cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261053cu,0x6665052eu,0x66650534u,0x5453052fu,0x6a690530u,0x7b7a0531u,0x66650532u,0x1000533u,0x80000051u,0x43420535u,0x76750536u,0x65640537u,0x68670538u,0x66650539u,0x7574053au,0x100053bu,0x80000052u,0x6f63053du,0x66650549u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7473054fu,0x4e4d054au,0x706f054bu,0x6564054cu,0x6665054du,0x100054eu,0x80000053u,0x67660550u,0x706f0551u,0x73720552u,0x6e6d0553u,0x1000554u,0x80000054u,0x6a690558u,0x0u,0x1000563u,0x75740559u,0x4544055au,0x6a69055bu,0x7473055cu,0x7574055du,0x6261055eu,0x6f6e055fu,0x64630560u,0x66650561u,0x1000562u,0x80000055u,0x80000056u,0x736c0573u,0x0u,0x0u,0x0u,0x737205e3u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c063cu,0x7675057au,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6905d4u,0x6665057bu,0x5300057cu,0x80000057u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626105cfu,0x6f6e05d0u,0x686705d1u,0x666505d2u,0x10005d3u,0x80000058u,0x626105d5u,0x6f6e05d6u,0x646305d7u,0x666505d8u,0x555405d9u,0x696805dau,0x737205dbu,0x666505dcu,0x747305ddu,0x696805deu,0x706f05dfu,0x6d6c05e0u,0x656405e1u,0x10005e2u,0x80000059u,0x757405e4u,0x666505e5u,0x797805e6u,0x2f2e05e7u,0x756105e8u,0x757405fcu,0x0u,0x7061060cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0621u,0x0u,0x706f0627u,0x0u,0x6261062fu,0x0u,0x62610635u,0x757405fdu,0x737205feu,0x6a6905ffu,0x63620600u,0x76750601u,0x75740602u,0x66650603u,0x34300604u,0x1000608u,0x1000609u,0x100060au,0x100060bu,0x8000005au,0x8000005bu,0x8000005cu,0x8000005du,0x7170061bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c061du,0x100061cu,0x8000005eu,0x706f061eu,0x7372061fu,0x1000620u,0x8000005fu,0x73720622u,0x6e6d0623u,0x62610624u,0x6d6c0625u,0x1000626u,0x80000060u,0x74730628u,0x6a690629u,0x7574062au,0x6a69062bu,0x706f062cu,0x6f6e062du,0x100062eu,0x80000061u,0x65640630u,0x6a690631u,0x76750632u,0x74730633u,0x1000634u,0x80000062u,0x6f6e0636u,0x68670637u,0x66650638u,0x6f6e0639u,0x7574063au,0x100063bu,0x80000063u,0x7675063du,0x6e6d063eu,0x6665063fu,0x1000640u,0x80000064u,0x73720645u,0x0u,0x0u,0x62610649u,0x6d6c0646u,0x65640647u,0x1000648u,0x80000065u,0x7170064au,0x4e4d064bu,0x706f064cu,0x6564064du,0x6665064eu,0x3431064fu,0x1000652u,0x1000653u,0x1000654u,0x80000066u,0x80000067u,0x80000068u};
    uint32_t cur = 0x78610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -78,10 +78,15 @@ static const int32_t anari_true = 1;
 static const int32_t anari_false = 0;
 const char ** query_extensions() {
    static const char *extensions[] = {
+      "ANARI_EXT_SAMPLER_COMPRESSED_IMAGE2D",
+      "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC123",
+      "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC45",
+      "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC67",
       "ANARI_KHR_INSTANCE_TRANSFORM",
       "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
       "ANARI_KHR_CAMERA_PERSPECTIVE",
       "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+      "ANARI_KHR_FRAME_ACCUMULATION",
       "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
       "ANARI_KHR_FRAME_CHANNEL_OBJECT_ID",
       "ANARI_KHR_FRAME_CHANNEL_INSTANCE_ID",
@@ -114,40 +119,40 @@ const char ** query_object_types(ANARIDataType type) {
          static const char *ANARI_RENDERER_subtypes[] = {"default", 0};
          return ANARI_RENDERER_subtypes;
       }
-      case ANARI_INSTANCE:
-      {
-         static const char *ANARI_INSTANCE_subtypes[] = {"transform", 0};
-         return ANARI_INSTANCE_subtypes;
-      }
-      case ANARI_CAMERA:
+      case ANARI_SPATIAL_FIELD:
       {
-         static const char *ANARI_CAMERA_subtypes[] = {"orthographic", "perspective", 0};
-         return ANARI_CAMERA_subtypes;
+         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", 0};
+         return ANARI_SPATIAL_FIELD_subtypes;
       }
       case ANARI_VOLUME:
       {
-         static const char *ANARI_VOLUME_subtypes[] = {"", "transferFunction1D", 0};
+         static const char *ANARI_VOLUME_subtypes[] = {"transferFunction1D", 0};
          return ANARI_VOLUME_subtypes;
       }
       case ANARI_GEOMETRY:
       {
-         static const char *ANARI_GEOMETRY_subtypes[] = {"cone", "curve", "cylinder", "quad", "sphere", "triangle", 0};
+         static const char *ANARI_GEOMETRY_subtypes[] = {"cone", "cylinder", "curve", "quad", "sphere", "triangle", 0};
          return ANARI_GEOMETRY_subtypes;
       }
-      case ANARI_MATERIAL:
-      {
-         static const char *ANARI_MATERIAL_subtypes[] = {"matte", 0};
-         return ANARI_MATERIAL_subtypes;
-      }
       case ANARI_SAMPLER:
       {
-         static const char *ANARI_SAMPLER_subtypes[] = {"image1D", "image2D", "image3D", "primitive", "transform", 0};
+         static const char *ANARI_SAMPLER_subtypes[] = {"image2D", "image3D", "compressedImage2D", "image1D", "primitive", "transform", 0};
          return ANARI_SAMPLER_subtypes;
       }
-      case ANARI_SPATIAL_FIELD:
+      case ANARI_INSTANCE:
       {
-         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", 0};
-         return ANARI_SPATIAL_FIELD_subtypes;
+         static const char *ANARI_INSTANCE_subtypes[] = {"transform", 0};
+         return ANARI_INSTANCE_subtypes;
+      }
+      case ANARI_CAMERA:
+      {
+         static const char *ANARI_CAMERA_subtypes[] = {"orthographic", "perspective", 0};
+         return ANARI_CAMERA_subtypes;
+      }
+      case ANARI_MATERIAL:
+      {
+         static const char *ANARI_MATERIAL_subtypes[] = {"matte", 0};
+         return ANARI_MATERIAL_subtypes;
       }
       default:
       {
@@ -204,7 +209,7 @@ static const void * ANARI_DEVICE_invalidMaterialColor_info(ANARIDataType paramTy
       default: return nullptr;
    }
 }
-static const void * ANARI_DEVICE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_bvh_buildQuality_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -213,15 +218,29 @@ static const void * ANARI_DEVICE_name_info(ANARIDataType paramType, int infoName
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "medium";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "default Embree build quality of group BVHs";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"low", "medium", "high", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_DEVICE_statusCallback_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_bvh_dynamic_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -230,15 +249,22 @@ static const void * ANARI_DEVICE_statusCallback_info(ANARIDataType paramType, in
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "callback used to report information to the application";
+            static const char *description = "use RTC_SCENE_FLAG_DYNAMIC for BVHs that change often";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_DEVICE_statusCallbackUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_bvh_compact_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -247,31 +273,22 @@ static const void * ANARI_DEVICE_statusCallbackUserData_info(ANARIDataType param
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional pointer passed as the first argument of the status callback";
+            static const char *description = "use RTC_SCENE_FLAG_COMPACT to reduce BVH memory";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_DEVICE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 0:
-         return ANARI_DEVICE_allowInvalidMaterials_info(paramType, infoName, infoType);
-      case 37:
-         return ANARI_DEVICE_invalidMaterialColor_info(paramType, infoName, infoType);
-      case 41:
-         return ANARI_DEVICE_name_info(paramType, infoName, infoType);
-      case 60:
-         return ANARI_DEVICE_statusCallback_info(paramType, infoName, infoType);
-      case 61:
-         return ANARI_DEVICE_statusCallbackUserData_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_RENDERER_default_background_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_bvh_robust_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -281,21 +298,21 @@ static const void * ANARI_RENDERER_default_background_info(ANARIDataType paramTy
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 1.000000f};
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "background color and alpha (RGBA)";
+            static const char *description = "use RTC_SCENE_FLAG_ROBUST for watertight traversal";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_RENDERER_default_ambientRadiance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_numThreads_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -305,21 +322,28 @@ static const void * ANARI_RENDERER_default_ambientRadiance_info(ANARIDataType pa
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "ambient light intensity";
+            static const char *description = "number of Embree worker threads, 0 uses all cores (set before creating objects)";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_RENDERER_default_mode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_setAffinity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -329,28 +353,21 @@ static const void * ANARI_RENDERER_default_mode_info(ANARIDataType paramType, in
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "default";
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "visualization modes (most for debugging)";
+            static const char *description = "pin Embree worker threads to cores (set before creating objects)";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"default", "primID", "geomID", "instID", "Ng", "Ng.abs", "uvw", "backface", "hitSurface", "hitVolume", "geometry.attribute0", "geometry.attribute1", "geometry.attribute2", "geometry.attribute3", "geometry.color", "opacityHeatmap", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_RENDERER_default_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_isa_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -359,15 +376,29 @@ static const void * ANARI_RENDERER_default_name_info(ANARIDataType paramType, in
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "default";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "restrict the ISA used by Embree, the bundled build only has SSE4.2 kernels (set before creating objects)";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"default", "sse4.2", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_RENDERER_default_ambientColor_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_memoryLimit_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -377,51 +408,21 @@ static const void * ANARI_RENDERER_default_ambientColor_info(ANARIDataType param
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "color";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "ambient light color";
+            static const char *description = "fail BVH builds which would exceed this many bytes, 0 is unlimited";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_RENDERER_AMBIENT_LIGHT";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 15;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_RENDERER_default_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 11:
-         return ANARI_RENDERER_default_background_info(paramType, infoName, infoType);
-      case 4:
-         return ANARI_RENDERER_default_ambientRadiance_info(paramType, infoName, infoType);
-      case 40:
-         return ANARI_RENDERER_default_mode_info(paramType, infoName, infoType);
-      case 41:
-         return ANARI_RENDERER_default_name_info(paramType, infoName, infoType);
-      case 3:
-         return ANARI_RENDERER_default_ambientColor_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -438,15 +439,7 @@ static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoNam
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_statusCallback_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -457,21 +450,13 @@ static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "callback used to report information to the application";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_statusCallbackUserData_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -482,21 +467,45 @@ static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "optional pointer passed as the first argument of the status callback";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_DEVICE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
+      case 2:
+         return ANARI_DEVICE_allowInvalidMaterials_info(paramType, infoName, infoType);
+      case 45:
+         return ANARI_DEVICE_invalidMaterialColor_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_DEVICE_bvh_buildQuality_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_DEVICE_bvh_dynamic_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_DEVICE_bvh_compact_info(paramType, infoName, infoType);
+      case 17:
+         return ANARI_DEVICE_bvh_robust_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_DEVICE_numThreads_info(paramType, infoName, infoType);
+      case 75:
+         return ANARI_DEVICE_setAffinity_info(paramType, infoName, infoType);
+      case 46:
+         return ANARI_DEVICE_isa_info(paramType, infoName, infoType);
+      case 51:
+         return ANARI_DEVICE_memoryLimit_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_DEVICE_name_info(paramType, infoName, infoType);
+      case 78:
+         return ANARI_DEVICE_statusCallback_info(paramType, infoName, infoType);
+      case 79:
+         return ANARI_DEVICE_statusCallbackUserData_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_tileSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -505,66 +514,108 @@ static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(16)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_UINT32 && infoType == ANARI_UINT32) {
+            static const uint32_t default_value[1] = {UINT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "edge length in pixels of the square tiles rendered in parallel";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_world_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_varianceThreshold_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "world to be rendererd";
+            static const char *description = "stop accumulating tiles whose estimated variance drops below this value (0 disables), requires accumulation";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_renderer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_timeBudget_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "renderer which renders the frame";
+            static const char *description = "seconds after which remaining tiles are skipped, showing their previous contents or black after a scene change, and rendered by the next frame (0 disables)";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_camera_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "camera used to render the world";
+            static const char *description = "optional object name";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_world_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -575,18 +626,69 @@ static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName,
          }
       case 4: // description
          {
-            static const char *description = "size of the frame in pixels (width, height)";
+            static const char *description = "world to be rendererd";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_renderer_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "renderer which renders the frame";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_camera_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "camera used to render the world";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "size of the frame in pixels (width, height)";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_channel_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
@@ -629,6 +731,31 @@ static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int
       default: return nullptr;
    }
 }
+static const void * ANARI_FRAME_accumulation_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "enable device internal buffers for frame accumulation";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_FRAME_ACCUMULATION";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -655,7 +782,7 @@ static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType
             static const char *extension = "KHR_FRAME_CHANNEL_PRIMITIVE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 4;
+            static const int32_t value = 9;
             return &value;
          }
       default: return nullptr;
@@ -687,7 +814,7 @@ static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, i
             static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
@@ -719,7 +846,7 @@ static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType,
             static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
@@ -744,7 +871,7 @@ static const void * ANARI_FRAME_frameCompletionCallback_info(ANARIDataType param
             static const char *extension = "KHR_FRAME_COMPLETION_CALLBACK";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -769,7 +896,7 @@ static const void * ANARI_FRAME_frameCompletionCallbackUserData_info(ANARIDataTy
             static const char *extension = "KHR_FRAME_COMPLETION_CALLBACK";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 7;
+            static const int32_t value = 12;
             return &value;
          }
       default: return nullptr;
@@ -777,35 +904,43 @@ static const void * ANARI_FRAME_frameCompletionCallbackUserData_info(ANARIDataTy
 }
 static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 41:
+      case 81:
+         return ANARI_FRAME_tileSize_info(paramType, infoName, infoType);
+      case 89:
+         return ANARI_FRAME_varianceThreshold_info(paramType, infoName, infoType);
+      case 82:
+         return ANARI_FRAME_timeBudget_info(paramType, infoName, infoType);
+      case 53:
          return ANARI_FRAME_name_info(paramType, infoName, infoType);
-      case 79:
+      case 101:
          return ANARI_FRAME_world_info(paramType, infoName, infoType);
-      case 57:
+      case 73:
          return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
-      case 12:
+      case 18:
          return ANARI_FRAME_camera_info(paramType, infoName, infoType);
-      case 58:
+      case 76:
          return ANARI_FRAME_size_info(paramType, infoName, infoType);
-      case 14:
+      case 21:
          return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
-      case 15:
+      case 22:
          return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
-      case 18:
+      case 0:
+         return ANARI_FRAME_accumulation_info(paramType, infoName, infoType);
+      case 25:
          return ANARI_FRAME_channel_primitiveId_info(paramType, infoName, infoType);
-      case 17:
+      case 24:
          return ANARI_FRAME_channel_objectId_info(paramType, infoName, infoType);
-      case 16:
+      case 23:
          return ANARI_FRAME_channel_instanceId_info(paramType, infoName, infoType);
-      case 25:
+      case 33:
          return ANARI_FRAME_frameCompletionCallback_info(paramType, infoName, infoType);
-      case 26:
+      case 34:
          return ANARI_FRAME_frameCompletionCallbackUserData_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_background_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -814,15 +949,22 @@ static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "background color and alpha (RGBA)";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_ambientRadiance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -831,22 +973,22 @@ static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoNa
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "array of surface objects";
+            static const char *description = "ambient light intensity";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_mode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -855,14 +997,21 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "default";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "array of volume objects";
+            static const char *description = "visualization modes (most for debugging)";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"default", "primID", "geomID", "instID", "Ng", "Ng.abs", "uvw", "backface", "hitSurface", "hitVolume", "geometry.attribute0", "geometry.attribute1", "geometry.attribute2", "geometry.attribute3", "geometry.color", "opacityHeatmap", nullptr};
             return values;
          } else {
             return nullptr;
@@ -870,7 +1019,7 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_traceMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -879,14 +1028,21 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "scalar";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "array of light objects";
+            static const char *description = "trace primary rays one at a time or as a coherent stream per tile";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"scalar", "stream", nullptr};
             return values;
          } else {
             return nullptr;
@@ -894,21 +1050,7 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_GROUP_name_info(paramType, infoName, infoType);
-      case 62:
-         return ANARI_GROUP_surface_info(paramType, infoName, infoType);
-      case 78:
-         return ANARI_GROUP_volume_info(paramType, infoName, infoType);
-      case 38:
-         return ANARI_GROUP_light_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_WORLD_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_pixelSamples_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -917,15 +1059,29 @@ static const void * ANARI_WORLD_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {INT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "number of jittered samples taken per pixel in each frame";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -936,20 +1092,13 @@ static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoN
          }
       case 4: // description
          {
-            static const char *description = "array of instance objects in the world";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_INSTANCE, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_ambientColor_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -958,22 +1107,56 @@ static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoNa
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "array of non-instanced surface objects in the world";
+            static const char *description = "ambient light color";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_RENDERER_AMBIENT_LIGHT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 20;
+            return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_RENDERER_default_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 13:
+         return ANARI_RENDERER_default_background_info(paramType, infoName, infoType);
+      case 6:
+         return ANARI_RENDERER_default_ambientRadiance_info(paramType, infoName, infoType);
+      case 52:
+         return ANARI_RENDERER_default_mode_info(paramType, infoName, infoType);
+      case 83:
+         return ANARI_RENDERER_default_traceMode_info(paramType, infoName, infoType);
+      case 61:
+         return ANARI_RENDERER_default_pixelSamples_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_RENDERER_default_name_info(paramType, infoName, infoType);
+      case 5:
+         return ANARI_RENDERER_default_ambientColor_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_WORLD_bvh_buildQuality_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -982,38 +1165,21 @@ static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "array of non-instanced volume objects in the world";
-            return description;
-         }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "medium";
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "array of non-instanced light objects in the world";
+            static const char *description = "Embree build quality of the top level BVH over all instances, moved instances are refit";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"low", "medium", "high", nullptr};
             return values;
          } else {
             return nullptr;
@@ -1021,23 +1187,7 @@ static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_WORLD_name_info(paramType, infoName, infoType);
-      case 36:
-         return ANARI_WORLD_instance_info(paramType, infoName, infoType);
-      case 62:
-         return ANARI_WORLD_surface_info(paramType, infoName, infoType);
-      case 78:
-         return ANARI_WORLD_volume_info(paramType, infoName, infoType);
-      case 38:
-         return ANARI_WORLD_light_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_bvh_dynamic_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1046,49 +1196,70 @@ static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoNam
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(1)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "use RTC_SCENE_FLAG_DYNAMIC for BVHs that change often";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_geometry_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_bvh_compact_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "geometry object defining the surface geometry";
+            static const char *description = "use RTC_SCENE_FLAG_COMPACT to reduce BVH memory";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_bvh_robust_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "material object defining the surface appearance";
+            static const char *description = "use RTC_SCENE_FLAG_ROBUST for watertight traversal";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1099,35 +1270,13 @@ static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName,
          }
       case 4: // description
          {
-            static const char *description = "user id for objectId channel";
+            static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_SURFACE_name_info(paramType, infoName, infoType);
-      case 27:
-         return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
-      case 39:
-         return ANARI_SURFACE_material_info(paramType, infoName, infoType);
-      case 30:
-         return ANARI_SURFACE_id_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_instance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1138,21 +1287,20 @@ static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "array of instance objects in the world";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_INSTANCE, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1161,55 +1309,46 @@ static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to objects in the instance";
+            static const char *description = "array of non-instanced surface objects in the world";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "group object being instanced";
+            static const char *description = "array of non-instanced volume objects in the world";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 0;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1220,35 +1359,44 @@ static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, in
          }
       case 4: // description
          {
-            static const char *description = "user id for instanceId channel";
+            static const char *description = "array of non-instanced light objects in the world";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 6;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_INSTANCE_transform_name_info(paramType, infoName, infoType);
-      case 63:
-         return ANARI_INSTANCE_transform_transform_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_INSTANCE_transform_group_info(paramType, infoName, infoType);
-      case 30:
-         return ANARI_INSTANCE_transform_id_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_WORLD_bvh_buildQuality_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_WORLD_bvh_dynamic_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_WORLD_bvh_compact_info(paramType, infoName, infoType);
+      case 17:
+         return ANARI_WORLD_bvh_robust_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_WORLD_name_info(paramType, infoName, infoType);
+      case 44:
+         return ANARI_WORLD_instance_info(paramType, infoName, infoType);
+      case 80:
+         return ANARI_WORLD_surface_info(paramType, infoName, infoType);
+      case 100:
+         return ANARI_WORLD_volume_info(paramType, infoName, infoType);
+      case 49:
+         return ANARI_WORLD_light_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_bvh_buildQuality_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1259,21 +1407,20 @@ static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "Embree build quality of this group's BVH, defaults to the device's 'bvh.buildQuality'";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"low", "medium", "high", nullptr};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_bvh_dynamic_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1282,36 +1429,15 @@ static const void * ANARI_CAMERA_orthographic_position_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "point";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "camera position";
+            static const char *description = "use RTC_SCENE_FLAG_DYNAMIC for this group's BVH, defaults to the device's 'bvh.dynamic'";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_bvh_compact_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1320,36 +1446,15 @@ static const void * ANARI_CAMERA_orthographic_direction_info(ANARIDataType param
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "direction";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "main viewing direction";
+            static const char *description = "use RTC_SCENE_FLAG_COMPACT for this group's BVH, defaults to the device's 'bvh.compact'";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_bvh_robust_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1358,36 +1463,32 @@ static const void * ANARI_CAMERA_orthographic_up_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
+      case 4: // description
+         {
+            static const char *description = "use RTC_SCENE_FLAG_ROBUST for this group's BVH, defaults to the device's 'bvh.robust'";
+            return description;
          }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "direction";
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "camera up direction";
+            static const char *description = "optional object name";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1396,30 +1497,22 @@ static const void * ANARI_CAMERA_orthographic_imageRegion_info(ANARIDataType par
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "region mapped to the frame";
+            static const char *description = "array of surface objects";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_aspect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1428,30 +1521,22 @@ static const void * ANARI_CAMERA_orthographic_aspect_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "aspect ratio";
+            static const char *description = "array of volume objects";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_height_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1460,30 +1545,44 @@ static const void * ANARI_CAMERA_orthographic_height_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "height of image plane";
+            static const char *description = "array of light objects";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_near_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 14:
+         return ANARI_GROUP_bvh_buildQuality_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_GROUP_bvh_dynamic_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_GROUP_bvh_compact_info(paramType, infoName, infoType);
+      case 17:
+         return ANARI_GROUP_bvh_robust_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_GROUP_name_info(paramType, infoName, infoType);
+      case 80:
+         return ANARI_GROUP_surface_info(paramType, infoName, infoType);
+      case 100:
+         return ANARI_GROUP_volume_info(paramType, infoName, infoType);
+      case 49:
+         return ANARI_GROUP_light_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_layout_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1492,23 +1591,29 @@ static const void * ANARI_CAMERA_orthographic_near_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "near plane clip distance";
+            static const char *description = "voxel storage order, 'bricked' copies the data into 8^3 bricks for cache-friendly sampling";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
-            return &value;
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"linear", "bricked", nullptr};
+            return values;
+         } else {
+            return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1519,70 +1624,53 @@ static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "far plane clip distance";
+            static const char *description = "optional object name";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 1;
+            static const int32_t value = 28;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
-      case 21:
-         return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
-      case 32:
-         return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
-      case 6:
-         return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
-      case 29:
-         return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
-      case 42:
-         return ANARI_CAMERA_orthographic_near_info(paramType, infoName, infoType);
-      case 22:
-         return ANARI_CAMERA_orthographic_far_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_CAMERA_perspective_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "array of vertex centered scalar values";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_INT16, ANARI_UINT16, ANARI_FLOAT32, ANARI_FLOAT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 28;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1598,29 +1686,23 @@ static const void * ANARI_CAMERA_perspective_position_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "point";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "camera position";
+            static const char *description = "origin of the grid in object-space";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 28;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1631,34 +1713,28 @@ static const void * ANARI_CAMERA_perspective_direction_info(ANARIDataType paramT
          }
       case 1: // default
          if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
             return default_value;
          } else {
             return nullptr;
          }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "direction";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "main viewing direction";
+            static const char *description = "size of the grid cells in object-space";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 28;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1668,35 +1744,54 @@ static const void * ANARI_CAMERA_perspective_up_info(ANARIDataType paramType, in
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
             return default_value;
          } else {
             return nullptr;
          }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "direction";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "camera up direction";
+            static const char *description = "filter mode used to interpolate the grid";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
+            static const int32_t value = 28;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 48:
+         return ANARI_SPATIAL_FIELD_structuredRegular_layout_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
+      case 27:
+         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
+      case 58:
+         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
+      case 77:
+         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_samplingRate_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1706,29 +1801,28 @@ static const void * ANARI_CAMERA_perspective_imageRegion_info(ANARIDataType para
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
             return default_value;
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "region mapped to the frame";
-            return description;
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
+      case 4: // description
+         {
+            static const char *description = "samples per half voxel spacing along each ray, lower is faster";
+            return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_fovy_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_opacityThreshold_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1739,28 +1833,34 @@ static const void * ANARI_CAMERA_perspective_fovy_info(ANARIDataType paramType,
          }
       case 1: // default
          if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.047198f};
+            static const float default_value[1] = {0.990000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 3: // maximum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertical field of view in radians";
+            static const char *description = "accumulated opacity at which ray marching terminates";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_aspect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_jitter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1770,29 +1870,21 @@ static const void * ANARI_CAMERA_perspective_aspect_info(ANARIDataType paramType
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "aspect ratio";
+            static const char *description = "randomly offset the first sample of each ray to trade banding for noise";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_near_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_adaptiveSampling_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1801,23 +1893,22 @@ static const void * ANARI_CAMERA_perspective_near_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "near plane clip distance";
+            static const char *description = "take larger steps where the field changes slowly, with opacity correction";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_preintegration_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1826,47 +1917,22 @@ static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {INT32_C(0)};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "far plane clip distance";
+            static const char *description = "shade each step from a preintegrated (front, back) sample table to keep thin features at coarse sampling rates";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 2;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
-      case 21:
-         return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
-      case 65:
-         return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
-      case 32:
-         return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
-      case 24:
-         return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
-      case 6:
-         return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
-      case 42:
-         return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
-      case 22:
-         return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_VOLUME__id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1885,21 +1951,13 @@ static const void * ANARI_VOLUME__id_info(ANARIDataType paramType, int infoName,
             static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 5;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME__param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 30:
-         return ANARI_VOLUME__id_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1915,41 +1973,41 @@ static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int i
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 29;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_value_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "uniform color";
+            static const char *description = "spatial field used for the field values of the volume";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 29;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_valueRange_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1958,73 +2016,94 @@ static const void * ANARI_GEOMETRY_cone_attribute0_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_BOX1 && infoType == ANARI_FLOAT32_BOX1) {
+            static const float default_value[2] = {0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform attribute0";
+            static const char *description = "sampled values of field are clamped to this range";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 29;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute1";
+            static const char *description = "sampled color";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 29;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute2";
+            static const char *description = "sampled opacity";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 29;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_unitDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2033,23 +2112,60 @@ static const void * ANARI_GEOMETRY_cone_attribute3_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform attribute3";
+            static const char *description = "makes volumes uniformly thinner or thicker";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 29;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 74:
+         return ANARI_VOLUME_transferFunction1D_samplingRate_info(paramType, infoName, infoType);
+      case 57:
+         return ANARI_VOLUME_transferFunction1D_opacityThreshold_info(paramType, infoName, infoType);
+      case 47:
+         return ANARI_VOLUME_transferFunction1D_jitter_info(paramType, infoName, infoType);
+      case 1:
+         return ANARI_VOLUME_transferFunction1D_adaptiveSampling_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_VOLUME_transferFunction1D_preintegration_info(paramType, infoName, infoType);
+      case 38:
+         return ANARI_VOLUME_transferFunction1D_id_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_VOLUME_transferFunction1D_name_info(paramType, infoName, infoType);
+      case 87:
+         return ANARI_VOLUME_transferFunction1D_value_info(paramType, infoName, infoType);
+      case 88:
+         return ANARI_VOLUME_transferFunction1D_valueRange_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_VOLUME_transferFunction1D_color_info(paramType, infoName, infoType);
+      case 56:
+         return ANARI_VOLUME_transferFunction1D_opacity_info(paramType, infoName, infoType);
+      case 85:
+         return ANARI_VOLUME_transferFunction1D_unitDistance_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_cone_capStyle_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2058,30 +2174,29 @@ static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType param
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "flat";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "per primitive color";
+            static const char *description = "shape of the cone caps enabled by 'caps' or 'vertex.cap'";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"flat", "round", nullptr};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2092,28 +2207,21 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute0";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2124,28 +2232,21 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute1";
+            static const char *description = "uniform color";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2156,28 +2257,21 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute2";
+            static const char *description = "uniform attribute0";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2188,28 +2282,21 @@ static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute3";
+            static const char *description = "uniform attribute1";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2220,60 +2307,46 @@ static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramTyp
          }
       case 4: // description
          {
-            static const char *description = "primitive id";
+            static const char *description = "uniform attribute2";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex position";
+            static const char *description = "uniform attribute3";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2284,12 +2357,12 @@ static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramTy
          }
       case 4: // description
          {
-            static const char *description = "vertex radius";
+            static const char *description = "per primitive color";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -2299,13 +2372,13 @@ static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramTy
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2316,12 +2389,12 @@ static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "vertex cap type";
+            static const char *description = "per primitive attribute0";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -2331,13 +2404,13 @@ static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType,
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2348,12 +2421,12 @@ static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramTyp
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "per primitive attribute1";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -2363,13 +2436,13 @@ static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramTyp
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2380,7 +2453,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "per primitive attribute2";
             return description;
          }
       case 5: // elementType
@@ -2395,13 +2468,13 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2412,7 +2485,7 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "per primitive attribute3";
             return description;
          }
       case 5: // elementType
@@ -2427,13 +2500,13 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2444,12 +2517,12 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "primitive id";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -2459,29 +2532,29 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "vertex position";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -2491,13 +2564,13 @@ static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType par
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2508,12 +2581,12 @@ static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType param
          }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "vertex radius";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -2523,13 +2596,13 @@ static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType param
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_cap_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2538,21 +2611,14 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "none";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "global cap type";
+            static const char *description = "vertex cap type";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"none", "first", "second", "both", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -2562,63 +2628,13 @@ static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int i
             static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 8;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_GEOMETRY_cone_name_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_GEOMETRY_cone_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_cone_attribute0_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_cone_attribute1_info(paramType, infoName, infoType);
-      case 9:
-         return ANARI_GEOMETRY_cone_attribute2_info(paramType, infoName, infoType);
-      case 10:
-         return ANARI_GEOMETRY_cone_attribute3_info(paramType, infoName, infoType);
-      case 52:
-         return ANARI_GEOMETRY_cone_primitive_color_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_cone_primitive_attribute0_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_cone_primitive_attribute1_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_cone_primitive_attribute2_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_cone_primitive_attribute3_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_GEOMETRY_cone_primitive_id_info(paramType, infoName, infoType);
-      case 75:
-         return ANARI_GEOMETRY_cone_vertex_position_info(paramType, infoName, infoType);
-      case 76:
-         return ANARI_GEOMETRY_cone_vertex_radius_info(paramType, infoName, infoType);
-      case 72:
-         return ANARI_GEOMETRY_cone_vertex_cap_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_cone_vertex_color_info(paramType, infoName, infoType);
-      case 68:
-         return ANARI_GEOMETRY_cone_vertex_attribute0_info(paramType, infoName, infoType);
-      case 69:
-         return ANARI_GEOMETRY_cone_vertex_attribute1_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_cone_vertex_attribute2_info(paramType, infoName, infoType);
-      case 71:
-         return ANARI_GEOMETRY_cone_vertex_attribute3_info(paramType, infoName, infoType);
-      case 54:
-         return ANARI_GEOMETRY_cone_primitive_index_info(paramType, infoName, infoType);
-      case 13:
-         return ANARI_GEOMETRY_cone_caps_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2629,21 +2645,28 @@ static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "vertex color";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2654,21 +2677,28 @@ static const void * ANARI_GEOMETRY_curve_color_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "uniform color";
+            static const char *description = "vertex attribute0";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2679,21 +2709,28 @@ static const void * ANARI_GEOMETRY_curve_attribute0_info(ANARIDataType paramType
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute0";
+            static const char *description = "vertex attribute1";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2704,21 +2741,28 @@ static const void * ANARI_GEOMETRY_curve_attribute1_info(ANARIDataType paramType
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute1";
+            static const char *description = "vertex attribute2";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2729,21 +2773,28 @@ static const void * ANARI_GEOMETRY_curve_attribute2_info(ANARIDataType paramType
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute2";
+            static const char *description = "vertex attribute3";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2754,21 +2805,28 @@ static const void * ANARI_GEOMETRY_curve_attribute3_info(ANARIDataType paramType
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute3";
+            static const char *description = "index array";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2777,30 +2835,89 @@ static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType para
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "per primitive color";
+            static const char *description = "global cap type";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "first", "second", "both", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CONE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 13;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 19:
+         return ANARI_GEOMETRY_cone_capStyle_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_GEOMETRY_cone_name_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_GEOMETRY_cone_color_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_GEOMETRY_cone_attribute0_info(paramType, infoName, infoType);
+      case 10:
+         return ANARI_GEOMETRY_cone_attribute1_info(paramType, infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_cone_attribute2_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_GEOMETRY_cone_attribute3_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_cone_primitive_color_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_cone_primitive_attribute0_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_cone_primitive_attribute1_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_GEOMETRY_cone_primitive_attribute2_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_cone_primitive_attribute3_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_cone_primitive_id_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_cone_vertex_position_info(paramType, infoName, infoType);
+      case 98:
+         return ANARI_GEOMETRY_cone_vertex_radius_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GEOMETRY_cone_vertex_cap_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_cone_vertex_color_info(paramType, infoName, infoType);
+      case 90:
+         return ANARI_GEOMETRY_cone_vertex_attribute0_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_GEOMETRY_cone_vertex_attribute1_info(paramType, infoName, infoType);
+      case 92:
+         return ANARI_GEOMETRY_cone_vertex_attribute2_info(paramType, infoName, infoType);
+      case 93:
+         return ANARI_GEOMETRY_cone_vertex_attribute3_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_cone_primitive_index_info(paramType, infoName, infoType);
+      case 20:
+         return ANARI_GEOMETRY_cone_caps_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_cylinder_capStyle_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2809,30 +2926,29 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "flat";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "per primitive attribute0";
+            static const char *description = "shape of the cylinder caps enabled by 'caps' or 'vertex.cap'";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"flat", "round", nullptr};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2843,28 +2959,21 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute1";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2875,28 +2984,21 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute2";
+            static const char *description = "uniform color";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2907,28 +3009,21 @@ static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute3";
+            static const char *description = "uniform attribute0";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2939,60 +3034,46 @@ static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramTy
          }
       case 4: // description
          {
-            static const char *description = "primitive id";
+            static const char *description = "uniform attribute1";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex position";
+            static const char *description = "uniform attribute2";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3003,28 +3084,21 @@ static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "vertex radius";
+            static const char *description = "uniform attribute3";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3035,7 +3109,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramTy
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "per primitive color";
             return description;
          }
       case 5: // elementType
@@ -3047,16 +3121,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramTy
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3067,7 +3141,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType pa
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "per primitive attribute0";
             return description;
          }
       case 5: // elementType
@@ -3079,16 +3153,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType pa
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3099,7 +3173,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType pa
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "per primitive attribute1";
             return description;
          }
       case 5: // elementType
@@ -3111,16 +3185,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType pa
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3131,7 +3205,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType pa
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "per primitive attribute2";
             return description;
          }
       case 5: // elementType
@@ -3143,16 +3217,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType pa
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3163,7 +3237,7 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType pa
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "per primitive attribute3";
             return description;
          }
       case 5: // elementType
@@ -3175,16 +3249,16 @@ static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType pa
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3195,7 +3269,7 @@ static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType para
          }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "primitive id";
             return description;
          }
       case 5: // elementType
@@ -3207,89 +3281,48 @@ static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "global radius";
+            static const char *description = "vertex position";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 9;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_GEOMETRY_curve_name_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_GEOMETRY_curve_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_curve_attribute0_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_curve_attribute1_info(paramType, infoName, infoType);
-      case 9:
-         return ANARI_GEOMETRY_curve_attribute2_info(paramType, infoName, infoType);
-      case 10:
-         return ANARI_GEOMETRY_curve_attribute3_info(paramType, infoName, infoType);
-      case 52:
-         return ANARI_GEOMETRY_curve_primitive_color_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_curve_primitive_attribute0_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_curve_primitive_attribute1_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_curve_primitive_attribute2_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
-      case 75:
-         return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
-      case 76:
-         return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
-      case 68:
-         return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
-      case 69:
-         return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
-      case 71:
-         return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
-      case 54:
-         return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
-      case 56:
-         return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3300,21 +3333,28 @@ static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, i
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "cylinder cap type";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3325,21 +3365,28 @@ static const void * ANARI_GEOMETRY_cylinder_color_info(ANARIDataType paramType,
          }
       case 4: // description
          {
-            static const char *description = "uniform color";
+            static const char *description = "vertex color";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3350,21 +3397,28 @@ static const void * ANARI_GEOMETRY_cylinder_attribute0_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute0";
+            static const char *description = "vertex attribute0";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3375,21 +3429,28 @@ static const void * ANARI_GEOMETRY_cylinder_attribute1_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute1";
+            static const char *description = "vertex attribute1";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3400,21 +3461,28 @@ static const void * ANARI_GEOMETRY_cylinder_attribute2_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute2";
+            static const char *description = "vertex attribute2";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3425,21 +3493,28 @@ static const void * ANARI_GEOMETRY_cylinder_attribute3_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute3";
+            static const char *description = "vertex attribute3";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3450,12 +3525,12 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "per primitive color";
+            static const char *description = "index array";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -3465,13 +3540,13 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType p
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3482,12 +3557,12 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataT
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute0";
+            static const char *description = "cylinder radius";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -3497,13 +3572,13 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3514,28 +3589,21 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataT
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute1";
+            static const char *description = "global cylinder radius";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3544,14 +3612,21 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataT
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "per primitive attribute2";
+            static const char *description = "global cylinder cap type";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "first", "second", "both", nullptr};
             return values;
          } else {
             return nullptr;
@@ -3561,13 +3636,67 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataT
             static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 15;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 19:
+         return ANARI_GEOMETRY_cylinder_capStyle_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_GEOMETRY_cylinder_name_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_GEOMETRY_cylinder_color_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_GEOMETRY_cylinder_attribute0_info(paramType, infoName, infoType);
+      case 10:
+         return ANARI_GEOMETRY_cylinder_attribute1_info(paramType, infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_cylinder_attribute2_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_GEOMETRY_cylinder_attribute3_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_cylinder_primitive_color_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute0_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute1_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute2_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_GEOMETRY_cylinder_vertex_cap_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
+      case 90:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
+      case 92:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
+      case 93:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_GEOMETRY_cylinder_primitive_radius_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
+      case 20:
+         return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3576,30 +3705,29 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataT
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "nearest";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "per primitive attribute3";
+            static const char *description = "filter mode, 'trilinear' blends the two nearest levels of a mip chain built on commit";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"trilinear", "nearest", "linear", nullptr};
             return values;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3610,28 +3738,21 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType para
          }
       case 4: // description
          {
-            static const char *description = "primitive id";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3642,28 +3763,28 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "vertex position";
+            static const char *description = "array backing the sampler";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3672,30 +3793,37 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_cap_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "attribute0";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "cylinder cap type";
+            static const char *description = "input surface attribute (texture coordinate)";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3704,30 +3832,37 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType para
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "wrap mode for the 1st dimension";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3736,30 +3871,37 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "wrap mode for the 2nd dimension";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3768,30 +3910,30 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "transform applied to the input attribute before sampling";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3800,30 +3942,30 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "offset added to output inTransform result";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3832,30 +3974,30 @@ static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "transform applied to the sampled values";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3864,30 +4006,56 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType p
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "offset added to output outTransform result";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 24;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 30:
+         return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_SAMPLER_image2D_name_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_image2D_image_info(paramType, infoName, infoType);
+      case 41:
+         return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image3D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3896,55 +4064,86 @@ static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "nearest";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "cylinder radius";
+            static const char *description = "filter mode, 'trilinear' blends the two nearest levels of a mip chain built on commit";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"trilinear", "nearest", "linear", nullptr};
             return values;
          } else {
             return nullptr;
          }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "global cylinder radius";
+            static const char *description = "array backing the sampler";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -3955,87 +4154,35 @@ static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, i
          }
       case 1: // default
          if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "none";
+            static const char *default_value = "attribute0";
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "global cylinder cap type";
+            static const char *description = "input surface attribute (texture coordinate)";
             return description;
          }
       case 6: // value
          if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"none", "first", "second", "both", nullptr};
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 10;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_GEOMETRY_cylinder_name_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_GEOMETRY_cylinder_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_cylinder_attribute0_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_cylinder_attribute1_info(paramType, infoName, infoType);
-      case 9:
-         return ANARI_GEOMETRY_cylinder_attribute2_info(paramType, infoName, infoType);
-      case 10:
-         return ANARI_GEOMETRY_cylinder_attribute3_info(paramType, infoName, infoType);
-      case 52:
-         return ANARI_GEOMETRY_cylinder_primitive_color_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_cylinder_primitive_attribute0_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_cylinder_primitive_attribute1_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_cylinder_primitive_attribute2_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
-      case 75:
-         return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
-      case 72:
-         return ANARI_GEOMETRY_cylinder_vertex_cap_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
-      case 68:
-         return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
-      case 69:
-         return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
-      case 71:
-         return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
-      case 54:
-         return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
-      case 55:
-         return ANARI_GEOMETRY_cylinder_primitive_radius_info(paramType, infoName, infoType);
-      case 56:
-         return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
-      case 13:
-         return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4044,23 +4191,37 @@ static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "wrap mode for the 1st dimension";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4069,23 +4230,37 @@ static const void * ANARI_GEOMETRY_quad_color_info(ANARIDataType paramType, int
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform color";
+            static const char *description = "wrap mode for the 2nd dimension";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_wrapMode3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4094,23 +4269,37 @@ static const void * ANARI_GEOMETRY_quad_attribute0_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform attribute0";
+            static const char *description = "wrap mode for the 3rd dimension";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4119,23 +4308,30 @@ static const void * ANARI_GEOMETRY_quad_attribute1_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform attribute1";
+            static const char *description = "transform applied to the input attribute before sampling";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4144,23 +4340,30 @@ static const void * ANARI_GEOMETRY_quad_attribute2_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform attribute2";
+            static const char *description = "offset added to output inTransform result";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4169,23 +4372,30 @@ static const void * ANARI_GEOMETRY_quad_attribute3_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform attribute3";
+            static const char *description = "transform applied to the sampled values";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4194,30 +4404,58 @@ static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType param
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "per primitive color";
+            static const char *description = "offset added to output outTransform result";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_SAMPLER_IMAGE3D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 25;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 30:
+         return ANARI_SAMPLER_image3D_filter_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_SAMPLER_image3D_name_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_image3D_image_info(paramType, infoName, infoType);
+      case 41:
+         return ANARI_SAMPLER_image3D_inAttribute_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_SAMPLER_image3D_wrapMode1_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_SAMPLER_image3D_wrapMode2_info(paramType, infoName, infoType);
+      case 104:
+         return ANARI_SAMPLER_image3D_wrapMode3_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SAMPLER_image3D_inTransform_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_SAMPLER_image3D_inOffset_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_image3D_outTransform_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_SAMPLER_image3D_outOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4228,28 +4466,21 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute0";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4260,28 +4491,21 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute1";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
-            return &value;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4292,60 +4516,111 @@ static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute2";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
-            return &value;
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_geometry_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "per primitive attribute3";
+            static const char *description = "geometry object defining the surface geometry";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "material object defining the surface appearance";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "user id for objectId channel";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 10;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_SURFACE_name_info(paramType, infoName, infoType);
+      case 35:
+         return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
+      case 50:
+         return ANARI_SURFACE_material_info(paramType, infoName, infoType);
+      case 38:
+         return ANARI_SURFACE_id_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_compressedImage2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4356,28 +4631,21 @@ static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramTyp
          }
       case 4: // description
          {
-            static const char *description = "primitive id";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4388,92 +4656,85 @@ static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType param
          }
       case 4: // description
          {
-            static const char *description = "vertex position";
+            static const char *description = "array backing the sampler";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_INT8, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_format_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "format";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"BC1_RGB", "BC1_RGB_SRGB", "BC1_RGBA", "BC1_RGBA_SRGB", "BC2", "BC2_SRGB", "BC3", "BC3_SRGB", "BC4", "BC4_SNORM", "BC5", "BC5_SNORM", "BC6H_UFLOAT", "BC6H_SFLOAT", "BC7", "BC7_SRGB", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_size_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "image size";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4482,30 +4743,37 @@ static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "attribute0";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "input surface attribute (texture coordinate)";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4514,30 +4782,37 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType par
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "nearest";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "filter mode";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4546,30 +4821,37 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType par
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "wrap mode for the 1st dimension";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4578,30 +4860,37 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType par
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "wrap mode for the 2nd dimension";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4610,30 +4899,30 @@ static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType par
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "transform applied to the input attribute before sampling";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4642,78 +4931,30 @@ static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType param
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "offset added to output inTransform result";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC4, ANARI_UINT64_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_QUAD";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 11;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_quad_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_GEOMETRY_quad_name_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_GEOMETRY_quad_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_quad_attribute0_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_quad_attribute1_info(paramType, infoName, infoType);
-      case 9:
-         return ANARI_GEOMETRY_quad_attribute2_info(paramType, infoName, infoType);
-      case 10:
-         return ANARI_GEOMETRY_quad_attribute3_info(paramType, infoName, infoType);
-      case 52:
-         return ANARI_GEOMETRY_quad_primitive_color_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_quad_primitive_attribute0_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_quad_primitive_attribute1_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_quad_primitive_attribute2_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_quad_primitive_attribute3_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_GEOMETRY_quad_primitive_id_info(paramType, infoName, infoType);
-      case 75:
-         return ANARI_GEOMETRY_quad_vertex_position_info(paramType, infoName, infoType);
-      case 74:
-         return ANARI_GEOMETRY_quad_vertex_normal_info(paramType, infoName, infoType);
-      case 77:
-         return ANARI_GEOMETRY_quad_vertex_tangent_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_quad_vertex_color_info(paramType, infoName, infoType);
-      case 68:
-         return ANARI_GEOMETRY_quad_vertex_attribute0_info(paramType, infoName, infoType);
-      case 69:
-         return ANARI_GEOMETRY_quad_vertex_attribute1_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_quad_vertex_attribute2_info(paramType, infoName, infoType);
-      case 71:
-         return ANARI_GEOMETRY_quad_vertex_attribute3_info(paramType, infoName, infoType);
-      case 54:
-         return ANARI_GEOMETRY_quad_primitive_index_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4722,23 +4963,30 @@ static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "transform applied to the sampled values";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4747,23 +4995,60 @@ static const void * ANARI_GEOMETRY_sphere_color_info(ANARIDataType paramType, in
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform color";
+            static const char *description = "offset added to output outTransform result";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 0;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_SAMPLER_compressedImage2D_name_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_compressedImage2D_image_info(paramType, infoName, infoType);
+      case 31:
+         return ANARI_SAMPLER_compressedImage2D_format_info(paramType, infoName, infoType);
+      case 76:
+         return ANARI_SAMPLER_compressedImage2D_size_info(paramType, infoName, infoType);
+      case 41:
+         return ANARI_SAMPLER_compressedImage2D_inAttribute_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_SAMPLER_compressedImage2D_filter_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_SAMPLER_compressedImage2D_wrapMode1_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_SAMPLER_compressedImage2D_wrapMode2_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SAMPLER_compressedImage2D_inTransform_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_SAMPLER_compressedImage2D_inOffset_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_compressedImage2D_outTransform_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_SAMPLER_compressedImage2D_outOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_INSTANCE_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4774,21 +5059,21 @@ static const void * ANARI_GEOMETRY_sphere_attribute0_info(ANARIDataType paramTyp
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute0";
+            static const char *description = "optional object name";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_transform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4797,48 +5082,55 @@ static const void * ANARI_GEOMETRY_sphere_attribute1_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "uniform attribute1";
+            static const char *description = "transform applied to objects in the instance";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_group_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute2";
+            static const char *description = "group object being instanced";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 4;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4849,21 +5141,35 @@ static const void * ANARI_GEOMETRY_sphere_attribute3_info(ANARIDataType paramTyp
          }
       case 4: // description
          {
-            static const char *description = "uniform attribute3";
+            static const char *description = "user id for instanceId channel";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_FRAME_CHANNEL_INSTANCE_ID";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 11;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_INSTANCE_transform_name_info(paramType, infoName, infoType);
+      case 84:
+         return ANARI_INSTANCE_transform_transform_info(paramType, infoName, infoType);
+      case 36:
+         return ANARI_INSTANCE_transform_group_info(paramType, infoName, infoType);
+      case 38:
+         return ANARI_INSTANCE_transform_id_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_orthographic_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4874,28 +5180,21 @@ static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "per primitive color";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4904,30 +5203,36 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataTyp
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "per primitive attribute0";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "point";
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "camera position";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4936,30 +5241,36 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataTyp
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "per primitive attribute1";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "main viewing direction";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -4968,30 +5279,36 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataTyp
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "per primitive attribute2";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "camera up direction";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5000,30 +5317,30 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataTyp
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "per primitive attribute3";
+            static const char *description = "region mapped to the frame";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_aspect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5032,62 +5349,62 @@ static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "primitive id";
+            static const char *description = "aspect ratio";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_height_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "sphere position";
+            static const char *description = "height of image plane";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_near_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5098,28 +5415,21 @@ static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType param
          }
       case 4: // description
          {
-            static const char *description = "sphere radius";
+            static const char *description = "near plane clip distance";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5130,28 +5440,45 @@ static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramT
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "far plane clip distance";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 5;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
+      case 28:
+         return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
+      case 86:
+         return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
+      case 40:
+         return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
+      case 8:
+         return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
+      case 37:
+         return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
+      case 54:
+         return ANARI_CAMERA_orthographic_near_info(paramType, infoName, infoType);
+      case 29:
+         return ANARI_CAMERA_orthographic_far_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5162,28 +5489,21 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "optional object name";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5192,30 +5512,36 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType p
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "vertex attribute1";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "point";
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "camera position";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5224,30 +5550,36 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType p
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "vertex attribute2";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "main viewing direction";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5256,30 +5588,36 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType p
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "vertex attribute3";
-            return description;
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
          } else {
             return nullptr;
          }
+      case 4: // description
+         {
+            static const char *description = "camera up direction";
+            return description;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_imageRegion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5288,30 +5626,30 @@ static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType par
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_BOX2 && infoType == ANARI_FLOAT32_BOX2) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "region mapped to the frame";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_fovy_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5320,71 +5658,136 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.047198f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "global sphere radius";
+            static const char *description = "vertical field of view in radians";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 12;
+            static const int32_t value = 6;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_GEOMETRY_sphere_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_sphere_attribute0_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_sphere_attribute1_info(paramType, infoName, infoType);
-      case 9:
-         return ANARI_GEOMETRY_sphere_attribute2_info(paramType, infoName, infoType);
-      case 10:
-         return ANARI_GEOMETRY_sphere_attribute3_info(paramType, infoName, infoType);
-      case 52:
-         return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
+static const void * ANARI_CAMERA_perspective_aspect_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "aspect ratio";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_near_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "near plane clip distance";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "far plane clip distance";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
       case 53:
-         return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
-      case 75:
-         return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
-      case 76:
-         return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
-      case 68:
-         return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
-      case 69:
-         return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
-      case 70:
-         return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
-      case 71:
-         return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
+         return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
+      case 28:
+         return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
+      case 86:
+         return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
+      case 40:
+         return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
+      case 32:
+         return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
+      case 8:
+         return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
       case 54:
-         return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
-      case 56:
-         return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
+         return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
+      case 29:
+         return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5400,16 +5803,16 @@ static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, i
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5425,16 +5828,16 @@ static const void * ANARI_GEOMETRY_triangle_color_info(ANARIDataType paramType,
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5450,16 +5853,16 @@ static const void * ANARI_GEOMETRY_triangle_attribute0_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5475,16 +5878,16 @@ static const void * ANARI_GEOMETRY_triangle_attribute1_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5500,16 +5903,16 @@ static const void * ANARI_GEOMETRY_triangle_attribute2_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5525,16 +5928,16 @@ static const void * ANARI_GEOMETRY_triangle_attribute3_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5557,16 +5960,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5589,16 +5992,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5621,16 +6024,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5653,16 +6056,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5685,16 +6088,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5717,16 +6120,16 @@ static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5749,16 +6152,16 @@ static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5769,28 +6172,28 @@ static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "vertex radius";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5801,28 +6204,28 @@ static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType pa
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "vertex color";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5833,28 +6236,28 @@ static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType para
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "vertex attribute0";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5865,7 +6268,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "vertex attribute1";
             return description;
          }
       case 5: // elementType
@@ -5877,16 +6280,16 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5897,7 +6300,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "vertex attribute2";
             return description;
          }
       case 5: // elementType
@@ -5909,16 +6312,16 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5929,7 +6332,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "vertex attribute3";
             return description;
          }
       case 5: // elementType
@@ -5941,16 +6344,16 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5961,28 +6364,28 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "index array";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -5993,76 +6396,69 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
          }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "global radius";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC3, ANARI_UINT64_VEC3, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 13;
+            static const int32_t value = 14;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_GEOMETRY_triangle_color_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_GEOMETRY_triangle_attribute0_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_GEOMETRY_triangle_attribute1_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_GEOMETRY_curve_name_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_GEOMETRY_curve_color_info(paramType, infoName, infoType);
       case 9:
-         return ANARI_GEOMETRY_triangle_attribute2_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_attribute0_info(paramType, infoName, infoType);
       case 10:
-         return ANARI_GEOMETRY_triangle_attribute3_info(paramType, infoName, infoType);
-      case 52:
-         return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
-      case 48:
-         return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
-      case 49:
-         return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
-      case 50:
-         return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
-      case 51:
-         return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
-      case 53:
-         return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
-      case 75:
-         return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
-      case 74:
-         return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
-      case 77:
-         return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
-      case 73:
-         return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_attribute1_info(paramType, infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_curve_attribute2_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_GEOMETRY_curve_attribute3_info(paramType, infoName, infoType);
       case 68:
-         return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_primitive_color_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_curve_primitive_attribute0_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_curve_primitive_attribute1_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_GEOMETRY_curve_primitive_attribute2_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
       case 69:
-         return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
+      case 98:
+         return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
+      case 90:
+         return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
+      case 92:
+         return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
+      case 93:
+         return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
       case 70:
-         return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
-      case 71:
-         return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
-      case 54:
-         return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6078,16 +6474,16 @@ static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6096,43 +6492,23 @@ static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.800000f, 0.800000f, 0.800000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
-      case 11: // use
-         if(infoType == ANARI_STRING) {
-            return "color";
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "diffuse color";
+            static const char *description = "uniform color";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6141,37 +6517,23 @@ static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "opacity";
+            static const char *description = "uniform attribute0";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6180,37 +6542,23 @@ static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "opaque";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "alpha mode";
+            static const char *description = "uniform attribute1";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"opaque", "blend", "mask", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6219,46 +6567,23 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {0.500000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "cutoff for alpha mask mode";
+            static const char *description = "uniform attribute2";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 14;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
-      case 43:
-         return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
-      case 2:
-         return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
-      case 1:
-         return ANARI_MATERIAL_matte_alphaCutoff_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6269,32 +6594,32 @@ static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "uniform attribute3";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "array backing the sampler";
+            static const char *description = "per primitive color";
             return description;
          }
       case 5: // elementType
@@ -6306,16 +6631,16 @@ static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, in
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6324,37 +6649,30 @@ static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "attribute0";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "input surface attribute (texture coordinate)";
+            static const char *description = "per primitive attribute0";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6363,37 +6681,30 @@ static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "nearest";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "filter mode";
+            static const char *description = "per primitive attribute1";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6402,37 +6713,30 @@ static const void * ANARI_SAMPLER_image1D_wrapMode1_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 1st dimension";
+            static const char *description = "per primitive attribute2";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6441,30 +6745,30 @@ static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to the input attribute before sampling";
+            static const char *description = "per primitive attribute3";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6473,62 +6777,62 @@ static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "offset added to output inTransform result";
+            static const char *description = "primitive id";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "transform applied to the sampled values";
+            static const char *description = "vertex position";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6537,54 +6841,30 @@ static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "offset added to output outTransform result";
+            static const char *description = "vertex normal";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 18;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_SAMPLER_image1D_name_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_SAMPLER_image1D_image_info(paramType, infoName, infoType);
-      case 33:
-         return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
-      case 23:
-         return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
-      case 80:
-         return ANARI_SAMPLER_image1D_wrapMode1_info(paramType, infoName, infoType);
-      case 35:
-         return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
-      case 34:
-         return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6595,32 +6875,39 @@ static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "vertex normal";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "array backing the sampler";
+            static const char *description = "vertex color";
             return description;
          }
       case 5: // elementType
@@ -6632,16 +6919,16 @@ static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, in
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6650,37 +6937,30 @@ static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "attribute0";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "input surface attribute (texture coordinate)";
+            static const char *description = "vertex attribute0";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6689,37 +6969,30 @@ static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "nearest";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "filter mode";
+            static const char *description = "vertex attribute1";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6728,37 +7001,30 @@ static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 1st dimension";
+            static const char *description = "vertex attribute2";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6767,37 +7033,30 @@ static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 2nd dimension";
+            static const char *description = "vertex attribute3";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_quad_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6806,62 +7065,103 @@ static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to the input attribute before sampling";
+            static const char *description = "index array";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC4, ANARI_UINT64_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 16;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
-         } else {
-            return nullptr;
-         }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
+static const void * ANARI_GEOMETRY_quad_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_GEOMETRY_quad_name_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_GEOMETRY_quad_color_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_GEOMETRY_quad_attribute0_info(paramType, infoName, infoType);
+      case 10:
+         return ANARI_GEOMETRY_quad_attribute1_info(paramType, infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_quad_attribute2_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_GEOMETRY_quad_attribute3_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_quad_primitive_color_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_quad_primitive_attribute0_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_quad_primitive_attribute1_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_GEOMETRY_quad_primitive_attribute2_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_quad_primitive_attribute3_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_quad_primitive_id_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_quad_vertex_position_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GEOMETRY_quad_vertex_normal_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_quad_vertex_tangent_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_quad_vertex_color_info(paramType, infoName, infoType);
+      case 90:
+         return ANARI_GEOMETRY_quad_vertex_attribute0_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_GEOMETRY_quad_vertex_attribute1_info(paramType, infoName, infoType);
+      case 92:
+         return ANARI_GEOMETRY_quad_vertex_attribute2_info(paramType, infoName, infoType);
+      case 93:
+         return ANARI_GEOMETRY_quad_vertex_attribute3_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_quad_primitive_index_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to output inTransform result";
+            static const char *description = "optional object name";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6870,30 +7170,23 @@ static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to the sampled values";
+            static const char *description = "uniform color";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6902,56 +7195,23 @@ static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "offset added to output outTransform result";
+            static const char *description = "uniform attribute0";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 19;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_SAMPLER_image2D_name_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_SAMPLER_image2D_image_info(paramType, infoName, infoType);
-      case 33:
-         return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
-      case 23:
-         return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
-      case 80:
-         return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
-      case 81:
-         return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
-      case 35:
-         return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
-      case 34:
-         return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_image3D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -6962,53 +7222,46 @@ static const void * ANARI_SAMPLER_image3D_name_info(ANARIDataType paramType, int
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "uniform attribute1";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "array backing the sampler";
+            static const char *description = "uniform attribute2";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7017,37 +7270,23 @@ static const void * ANARI_SAMPLER_image3D_inAttribute_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "attribute0";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "input surface attribute (texture coordinate)";
+            static const char *description = "uniform attribute3";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7056,37 +7295,30 @@ static const void * ANARI_SAMPLER_image3D_filter_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "nearest";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "filter mode";
+            static const char *description = "per primitive color";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7095,37 +7327,30 @@ static const void * ANARI_SAMPLER_image3D_wrapMode1_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 1st dimension";
+            static const char *description = "per primitive attribute0";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7134,37 +7359,30 @@ static const void * ANARI_SAMPLER_image3D_wrapMode2_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 2nd dimension";
+            static const char *description = "per primitive attribute1";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_wrapMode3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7173,37 +7391,30 @@ static const void * ANARI_SAMPLER_image3D_wrapMode3_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "clampToEdge";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "wrap mode for the 3rd dimension";
+            static const char *description = "per primitive attribute2";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7212,30 +7423,30 @@ static const void * ANARI_SAMPLER_image3D_inTransform_info(ANARIDataType paramTy
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "transform applied to the input attribute before sampling";
+            static const char *description = "per primitive attribute3";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7244,30 +7455,62 @@ static const void * ANARI_SAMPLER_image3D_inOffset_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
+      case 4: // description
+         {
+            static const char *description = "primitive id";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to output inTransform result";
+            static const char *description = "sphere position";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7276,30 +7519,62 @@ static const void * ANARI_SAMPLER_image3D_outTransform_info(ANARIDataType paramT
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
-            return default_value;
+      case 4: // description
+         {
+            static const char *description = "sphere radius";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "transform applied to the sampled values";
+            static const char *description = "vertex color";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7308,58 +7583,94 @@ static const void * ANARI_SAMPLER_image3D_outOffset_info(ANARIDataType paramType
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
-            return default_value;
+      case 4: // description
+         {
+            static const char *description = "vertex attribute0";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to output outTransform result";
+            static const char *description = "vertex attribute1";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 20;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_image3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_SAMPLER_image3D_name_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_SAMPLER_image3D_image_info(paramType, infoName, infoType);
-      case 33:
-         return ANARI_SAMPLER_image3D_inAttribute_info(paramType, infoName, infoType);
-      case 23:
-         return ANARI_SAMPLER_image3D_filter_info(paramType, infoName, infoType);
-      case 80:
-         return ANARI_SAMPLER_image3D_wrapMode1_info(paramType, infoName, infoType);
-      case 81:
-         return ANARI_SAMPLER_image3D_wrapMode2_info(paramType, infoName, infoType);
-      case 82:
-         return ANARI_SAMPLER_image3D_wrapMode3_info(paramType, infoName, infoType);
-      case 35:
-         return ANARI_SAMPLER_image3D_inTransform_info(paramType, infoName, infoType);
-      case 34:
-         return ANARI_SAMPLER_image3D_inOffset_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_SAMPLER_image3D_outTransform_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_SAMPLER_image3D_outOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute2";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7370,53 +7681,60 @@ static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, i
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "vertex attribute3";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_primitive_array_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "backing array of the sampler";
+            static const char *description = "index array";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 17;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7425,67 +7743,1002 @@ static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
-            static const uint64_t default_value[1] = {UINT64_C(0)};
-            return default_value;
+      case 4: // description
+         {
+            static const char *description = "global sphere radius";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_GEOMETRY_sphere_color_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_GEOMETRY_sphere_attribute0_info(paramType, infoName, infoType);
+      case 10:
+         return ANARI_GEOMETRY_sphere_attribute1_info(paramType, infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_sphere_attribute2_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_GEOMETRY_sphere_attribute3_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
+      case 98:
+         return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
+      case 90:
+         return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
+      case 92:
+         return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
+      case 93:
+         return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "uniform color";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "uniform attribute0";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "uniform attribute1";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "uniform attribute2";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "uniform attribute3";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive attribute0";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive attribute1";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive attribute2";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive attribute3";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "primitive id";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex position";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex normal";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex normal";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute0";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute1";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute2";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute3";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "index array";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC3, ANARI_UINT64_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 18;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_GEOMETRY_triangle_color_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_GEOMETRY_triangle_attribute0_info(paramType, infoName, infoType);
+      case 10:
+         return ANARI_GEOMETRY_triangle_attribute1_info(paramType, infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_triangle_attribute2_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_GEOMETRY_triangle_attribute3_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
+      case 90:
+         return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
+      case 92:
+         return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
+      case 93:
+         return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 19;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.800000f, 0.800000f, 0.800000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "diffuse color";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 19;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "opacity";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 19;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "opaque";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "alpha mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"opaque", "blend", "mask", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 19;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.500000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "cutoff for alpha mask mode";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 19;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
+      case 56:
+         return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
+      case 4:
+         return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
+      case 3:
+         return ANARI_MATERIAL_matte_alphaCutoff_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to primitiveId";
+            static const char *description = "optional object name";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 21;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_primitive_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_SAMPLER_primitive_name_info(paramType, infoName, infoType);
-      case 5:
-         return ANARI_SAMPLER_primitive_array_info(paramType, infoName, infoType);
-      case 34:
-         return ANARI_SAMPLER_primitive_inOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "array backing the sampler";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7515,16 +8768,16 @@ static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType param
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7534,29 +8787,36 @@ static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType para
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
-            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "nearest";
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "transform applied to the input attribute";
+            static const char *description = "filter mode";
             return description;
          }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
+            static const int32_t value = 23;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7566,59 +8826,27 @@ static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramTy
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
-            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "offset added to output outTransform result";
+            static const char *description = "wrap mode for the 1st dimension";
             return description;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 22;
-            return &value;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 41:
-         return ANARI_SAMPLER_transform_name_info(paramType, infoName, infoType);
-      case 33:
-         return ANARI_SAMPLER_transform_inAttribute_info(paramType, infoName, infoType);
-      case 46:
-         return ANARI_SAMPLER_transform_outTransform_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_SAMPLER_transform_outOffset_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   (void)paramType;
-   switch(infoName) {
-      case 0: // required
-         if(infoType == ANARI_BOOL) {
-            return &anari_false;
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
          } else {
             return nullptr;
          }
-      case 4: // description
-         {
-            static const char *description = "optional object name";
-            return description;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 23;
@@ -7627,30 +8855,30 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataTyp
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "array of vertex centered scalar values";
+            static const char *description = "transform applied to the input attribute before sampling";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT8, ANARI_INT16, ANARI_UINT16, ANARI_FLOAT32, ANARI_FLOAT64, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 23;
@@ -7659,7 +8887,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataTyp
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7669,20 +8897,20 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "origin of the grid in object-space";
+            static const char *description = "offset added to output inTransform result";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 23;
@@ -7691,7 +8919,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataT
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7701,20 +8929,20 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIData
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "size of the grid cells in object-space";
+            static const char *description = "transform applied to the sampled values";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 23;
@@ -7723,7 +8951,7 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIData
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7733,27 +8961,20 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "linear";
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "filter mode used to interpolate the grid";
+            static const char *description = "offset added to output outTransform result";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"nearest", "linear", nullptr};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 23;
@@ -7762,23 +8983,31 @@ static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataT
       default: return nullptr;
    }
 }
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_SAMPLER_image1D_name_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_image1D_image_info(paramType, infoName, infoType);
       case 41:
-         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
-      case 20:
-         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
-      case 44:
-         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
+         return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_SAMPLER_image1D_wrapMode1_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
       case 59:
-         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
-      case 23:
-         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+         return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_primitive_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7794,16 +9023,16 @@ static const void * ANARI_VOLUME_transferFunction1D_name_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
+            static const int32_t value = 26;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_value_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_primitive_array_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7814,21 +9043,28 @@ static const void * ANARI_VOLUME_transferFunction1D_value_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "spatial field used for the field values of the volume";
+            static const char *description = "backing array of the sampler";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
+            static const int32_t value = 26;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_valueRange_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_primitive_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7838,93 +9074,137 @@ static const void * ANARI_VOLUME_transferFunction1D_valueRange_info(ANARIDataTyp
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32_BOX1 && infoType == ANARI_FLOAT32_BOX1) {
-            static const float default_value[2] = {0.000000f, 1.000000f};
+         if(paramType == ANARI_UINT64 && infoType == ANARI_UINT64) {
+            static const uint64_t default_value[1] = {UINT64_C(0)};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "sampled values of field are clamped to this range";
+            static const char *description = "offset added to primitiveId";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_PRIMITIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 26;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_primitive_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_SAMPLER_primitive_name_info(paramType, infoName, infoType);
+      case 7:
+         return ANARI_SAMPLER_primitive_array_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_SAMPLER_primitive_inOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_transform_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
+            static const int32_t value = 27;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "attribute0";
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "sampled color";
+            static const char *description = "input surface attribute (texture coordinate)";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
+            static const int32_t value = 27;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "sampled opacity";
+            static const char *description = "transform applied to the input attribute";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
-            return values;
-         } else {
-            return nullptr;
-         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
+            static const int32_t value = 27;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_unitDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -7934,42 +9214,38 @@ static const void * ANARI_VOLUME_transferFunction1D_unitDistance_info(ANARIDataT
             return nullptr;
          }
       case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
             return default_value;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "makes volumes uniformly thinner or thicker";
+            static const char *description = "offset added to output outTransform result";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int32_t value = 24;
+            static const int32_t value = 27;
             return &value;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_transform_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_SAMPLER_transform_name_info(paramType, infoName, infoType);
       case 41:
-         return ANARI_VOLUME_transferFunction1D_name_info(paramType, infoName, infoType);
-      case 66:
-         return ANARI_VOLUME_transferFunction1D_value_info(paramType, infoName, infoType);
-      case 67:
-         return ANARI_VOLUME_transferFunction1D_valueRange_info(paramType, infoName, infoType);
-      case 19:
-         return ANARI_VOLUME_transferFunction1D_color_info(paramType, infoName, infoType);
-      case 43:
-         return ANARI_VOLUME_transferFunction1D_opacity_info(paramType, infoName, infoType);
-      case 64:
-         return ANARI_VOLUME_transferFunction1D_unitDistance_info(paramType, infoName, infoType);
+         return ANARI_SAMPLER_transform_inAttribute_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_SAMPLER_transform_outTransform_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_SAMPLER_transform_outOffset_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -7988,10 +9264,10 @@ static const void * ANARI_GEOMETRY_param_info(const char *subtype, const char *p
    switch(subtype_hash(subtype)) {
       case 1:
          return ANARI_GEOMETRY_cone_param_info(paramName, paramType, infoName, infoType);
-      case 2:
-         return ANARI_GEOMETRY_curve_param_info(paramName, paramType, infoName, infoType);
       case 3:
          return ANARI_GEOMETRY_cylinder_param_info(paramName, paramType, infoName, infoType);
+      case 2:
+         return ANARI_GEOMETRY_curve_param_info(paramName, paramType, infoName, infoType);
       case 12:
          return ANARI_GEOMETRY_quad_param_info(paramName, paramType, infoName, infoType);
       case 13:
@@ -8028,12 +9304,14 @@ static const void * ANARI_RENDERER_param_info(const char *subtype, const char *p
 }
 static const void * ANARI_SAMPLER_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 5:
-         return ANARI_SAMPLER_image1D_param_info(paramName, paramType, infoName, infoType);
       case 6:
          return ANARI_SAMPLER_image2D_param_info(paramName, paramType, infoName, infoType);
       case 7:
          return ANARI_SAMPLER_image3D_param_info(paramName, paramType, infoName, infoType);
+      case 0:
+         return ANARI_SAMPLER_compressedImage2D_param_info(paramName, paramType, infoName, infoType);
+      case 5:
+         return ANARI_SAMPLER_image1D_param_info(paramName, paramType, infoName, infoType);
       case 11:
          return ANARI_SAMPLER_primitive_param_info(paramName, paramType, infoName, infoType);
       case 16:
@@ -8052,8 +9330,6 @@ static const void * ANARI_SPATIAL_FIELD_param_info(const char *subtype, const ch
 }
 static const void * ANARI_VOLUME_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 0:
-         return ANARI_VOLUME__param_info(paramName, paramType, infoName, infoType);
       case 15:
          return ANARI_VOLUME_transferFunction1D_param_info(paramName, paramType, infoName, infoType);
       default:
@@ -8080,18 +9356,18 @@ const void * query_param_info_enum(ANARIDataType type, const char *subtype, cons
          return ANARI_VOLUME_param_info(subtype, paramName, paramType, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_WORLD:
+         return ANARI_WORLD_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_GROUP:
+         return ANARI_GROUP_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY1D:
          return ANARI_ARRAY1D_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY2D:
          return ANARI_ARRAY2D_param_info(paramName, paramType, infoName, infoType);
       case ANARI_ARRAY3D:
          return ANARI_ARRAY3D_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_GROUP:
-         return ANARI_GROUP_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_WORLD:
-         return ANARI_WORLD_param_info(paramName, paramType, infoName, infoType);
       case ANARI_SURFACE:
          return ANARI_SURFACE_param_info(paramName, paramType, infoName, infoType);
       default:
@@ -8114,6 +9390,14 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
             static const ANARIParameter parameters[] = {
                {"allowInvalidMaterials", ANARI_BOOL},
                {"invalidMaterialColor", ANARI_FLOAT32_VEC4},
+               {"bvh.buildQuality", ANARI_STRING},
+               {"bvh.dynamic", ANARI_BOOL},
+               {"bvh.compact", ANARI_BOOL},
+               {"bvh.robust", ANARI_BOOL},
+               {"numThreads", ANARI_INT32},
+               {"setAffinity", ANARI_BOOL},
+               {"isa", ANARI_STRING},
+               {"memoryLimit", ANARI_UINT64},
                {"name", ANARI_STRING},
                {"statusCallback", ANARI_STATUS_CALLBACK},
                {"statusCallbackUserData", ANARI_VOID_POINTER},
@@ -8126,10 +9410,15 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
       case 8: // extension
          if(infoType == ANARI_STRING_LIST) {
             static const char *extensions[] = {
+               "ANARI_EXT_SAMPLER_COMPRESSED_IMAGE2D",
+               "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC123",
+               "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC45",
+               "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC67",
                "ANARI_KHR_INSTANCE_TRANSFORM",
                "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
                "ANARI_KHR_CAMERA_PERSPECTIVE",
                "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+               "ANARI_KHR_FRAME_ACCUMULATION",
                "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
                "ANARI_KHR_FRAME_CHANNEL_OBJECT_ID",
                "ANARI_KHR_FRAME_CHANNEL_INSTANCE_ID",
@@ -8160,6 +9449,55 @@ static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
+static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "frame object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"tileSize", ANARI_UINT32},
+               {"varianceThreshold", ANARI_FLOAT32},
+               {"timeBudget", ANARI_FLOAT32},
+               {"name", ANARI_STRING},
+               {"world", ANARI_WORLD},
+               {"renderer", ANARI_RENDERER},
+               {"camera", ANARI_CAMERA},
+               {"size", ANARI_UINT32_VEC2},
+               {"channel.color", ANARI_DATA_TYPE},
+               {"channel.depth", ANARI_DATA_TYPE},
+               {"accumulation", ANARI_BOOL},
+               {"channel.primitiveId", ANARI_DATA_TYPE},
+               {"channel.objectId", ANARI_DATA_TYPE},
+               {"channel.instanceId", ANARI_DATA_TYPE},
+               {"frameCompletionCallback", ANARI_FRAME_COMPLETION_CALLBACK},
+               {"frameCompletionCallbackUserData", ANARI_VOID_POINTER},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 10: // channel
+         if(infoType == ANARI_STRING_LIST) {
+            static const char *channel[] = {
+               "channel.color",
+               "channel.depth",
+               "channel.primitiveId",
+               "channel.objectId",
+               "channel.instanceId",
+               0
+            };
+            return channel;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
@@ -8170,68 +9508,170 @@ static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType info
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
-               {"background", ANARI_FLOAT32_VEC4},
-               {"background", ANARI_FLOAT32_VEC4},
-               {"background", ANARI_ARRAY2D},
-               {"ambientRadiance", ANARI_FLOAT32},
-               {"ambientRadiance", ANARI_FLOAT32},
-               {"mode", ANARI_STRING},
+               {"background", ANARI_FLOAT32_VEC4},
+               {"background", ANARI_FLOAT32_VEC4},
+               {"background", ANARI_ARRAY2D},
+               {"ambientRadiance", ANARI_FLOAT32},
+               {"ambientRadiance", ANARI_FLOAT32},
+               {"mode", ANARI_STRING},
+               {"traceMode", ANARI_STRING},
+               {"pixelSamples", ANARI_INT32},
+               {"name", ANARI_STRING},
+               {"ambientColor", ANARI_FLOAT32_VEC3},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 8: // extension
+         if(infoType == ANARI_STRING_LIST) {
+            static const char *extensions[] = {
+               "ANARI_EXT_SAMPLER_COMPRESSED_IMAGE2D",
+               "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC123",
+               "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC45",
+               "ANARI_EXT_SAMPLER_COMPRESSED_FORMAT_BC67",
+               "ANARI_KHR_INSTANCE_TRANSFORM",
+               "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
+               "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+               "ANARI_KHR_FRAME_ACCUMULATION",
+               "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
+               "ANARI_KHR_FRAME_CHANNEL_OBJECT_ID",
+               "ANARI_KHR_FRAME_CHANNEL_INSTANCE_ID",
+               "ANARI_KHR_FRAME_COMPLETION_CALLBACK",
+               "ANARI_KHR_GEOMETRY_CONE",
+               "ANARI_KHR_GEOMETRY_CURVE",
+               "ANARI_KHR_GEOMETRY_CYLINDER",
+               "ANARI_KHR_GEOMETRY_QUAD",
+               "ANARI_KHR_GEOMETRY_SPHERE",
+               "ANARI_KHR_GEOMETRY_TRIANGLE",
+               "ANARI_KHR_MATERIAL_MATTE",
+               "ANARI_KHR_RENDERER_AMBIENT_LIGHT",
+               "ANARI_KHR_RENDERER_BACKGROUND_COLOR",
+               "ANARI_KHR_RENDERER_BACKGROUND_IMAGE",
+               "ANARI_KHR_SAMPLER_IMAGE1D",
+               "ANARI_KHR_SAMPLER_IMAGE2D",
+               "ANARI_KHR_SAMPLER_IMAGE3D",
+               "ANARI_KHR_SAMPLER_PRIMITIVE",
+               "ANARI_KHR_SAMPLER_TRANSFORM",
+               "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
+               "ANARI_KHR_VOLUME_TRANSFER_FUNCTION1D",
+               0
+            };
+            return extensions;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "world object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"bvh.buildQuality", ANARI_STRING},
+               {"bvh.dynamic", ANARI_BOOL},
+               {"bvh.compact", ANARI_BOOL},
+               {"bvh.robust", ANARI_BOOL},
+               {"name", ANARI_STRING},
+               {"instance", ANARI_ARRAY1D},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "group object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"bvh.buildQuality", ANARI_STRING},
+               {"bvh.dynamic", ANARI_BOOL},
+               {"bvh.compact", ANARI_BOOL},
+               {"bvh.robust", ANARI_BOOL},
+               {"name", ANARI_STRING},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "structured regular spatial field object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"layout", ANARI_STRING},
                {"name", ANARI_STRING},
-               {"ambientColor", ANARI_FLOAT32_VEC3},
+               {"data", ANARI_ARRAY3D},
+               {"origin", ANARI_FLOAT32_VEC3},
+               {"spacing", ANARI_FLOAT32_VEC3},
+               {"filter", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 8: // extension
-         if(infoType == ANARI_STRING_LIST) {
-            static const char *extensions[] = {
-               "ANARI_KHR_INSTANCE_TRANSFORM",
-               "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
-               "ANARI_KHR_CAMERA_PERSPECTIVE",
-               "ANARI_KHR_DEVICE_SYNCHRONIZATION",
-               "ANARI_KHR_FRAME_CHANNEL_PRIMITIVE_ID",
-               "ANARI_KHR_FRAME_CHANNEL_OBJECT_ID",
-               "ANARI_KHR_FRAME_CHANNEL_INSTANCE_ID",
-               "ANARI_KHR_FRAME_COMPLETION_CALLBACK",
-               "ANARI_KHR_GEOMETRY_CONE",
-               "ANARI_KHR_GEOMETRY_CURVE",
-               "ANARI_KHR_GEOMETRY_CYLINDER",
-               "ANARI_KHR_GEOMETRY_QUAD",
-               "ANARI_KHR_GEOMETRY_SPHERE",
-               "ANARI_KHR_GEOMETRY_TRIANGLE",
-               "ANARI_KHR_MATERIAL_MATTE",
-               "ANARI_KHR_RENDERER_AMBIENT_LIGHT",
-               "ANARI_KHR_RENDERER_BACKGROUND_COLOR",
-               "ANARI_KHR_RENDERER_BACKGROUND_IMAGE",
-               "ANARI_KHR_SAMPLER_IMAGE1D",
-               "ANARI_KHR_SAMPLER_IMAGE2D",
-               "ANARI_KHR_SAMPLER_IMAGE3D",
-               "ANARI_KHR_SAMPLER_PRIMITIVE",
-               "ANARI_KHR_SAMPLER_TRANSFORM",
-               "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
-               "ANARI_KHR_VOLUME_TRANSFER_FUNCTION1D",
-               0
-            };
-            return extensions;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "one dimensional array object";
+            static const char *description = "transferFunction1D volume object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"samplingRate", ANARI_FLOAT32},
+               {"opacityThreshold", ANARI_FLOAT32},
+               {"jitter", ANARI_BOOL},
+               {"adaptiveSampling", ANARI_BOOL},
+               {"preintegration", ANARI_BOOL},
+               {"id", ANARI_UINT32},
                {"name", ANARI_STRING},
+               {"value", ANARI_SPATIAL_FIELD},
+               {"valueRange", ANARI_FLOAT32_BOX1},
+               {"valueRange", ANARI_FLOAT64_BOX1},
+               {"color", ANARI_FLOAT32_VEC4},
+               {"color", ANARI_FLOAT32_VEC3},
+               {"color", ANARI_ARRAY1D},
+               {"opacity", ANARI_FLOAT32},
+               {"opacity", ANARI_ARRAY1D},
+               {"unitDistance", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8241,17 +9681,39 @@ static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cone_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "two dimensional array object";
+            static const char *description = "cone geometry object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"capStyle", ANARI_STRING},
                {"name", ANARI_STRING},
+               {"color", ANARI_FLOAT32_VEC4},
+               {"attribute0", ANARI_FLOAT32_VEC4},
+               {"attribute1", ANARI_FLOAT32_VEC4},
+               {"attribute2", ANARI_FLOAT32_VEC4},
+               {"attribute3", ANARI_FLOAT32_VEC4},
+               {"primitive.color", ANARI_ARRAY1D},
+               {"primitive.attribute0", ANARI_ARRAY1D},
+               {"primitive.attribute1", ANARI_ARRAY1D},
+               {"primitive.attribute2", ANARI_ARRAY1D},
+               {"primitive.attribute3", ANARI_ARRAY1D},
+               {"primitive.id", ANARI_ARRAY1D},
+               {"vertex.position", ANARI_ARRAY1D},
+               {"vertex.radius", ANARI_ARRAY1D},
+               {"vertex.cap", ANARI_ARRAY1D},
+               {"vertex.color", ANARI_ARRAY1D},
+               {"vertex.attribute0", ANARI_ARRAY1D},
+               {"vertex.attribute1", ANARI_ARRAY1D},
+               {"vertex.attribute2", ANARI_ARRAY1D},
+               {"vertex.attribute3", ANARI_ARRAY1D},
+               {"primitive.index", ANARI_ARRAY1D},
+               {"caps", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8261,17 +9723,40 @@ static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "three dimensional array object";
+            static const char *description = "cylinder geometry object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"capStyle", ANARI_STRING},
                {"name", ANARI_STRING},
+               {"color", ANARI_FLOAT32_VEC4},
+               {"attribute0", ANARI_FLOAT32_VEC4},
+               {"attribute1", ANARI_FLOAT32_VEC4},
+               {"attribute2", ANARI_FLOAT32_VEC4},
+               {"attribute3", ANARI_FLOAT32_VEC4},
+               {"primitive.color", ANARI_ARRAY1D},
+               {"primitive.attribute0", ANARI_ARRAY1D},
+               {"primitive.attribute1", ANARI_ARRAY1D},
+               {"primitive.attribute2", ANARI_ARRAY1D},
+               {"primitive.attribute3", ANARI_ARRAY1D},
+               {"primitive.id", ANARI_ARRAY1D},
+               {"vertex.position", ANARI_ARRAY1D},
+               {"vertex.cap", ANARI_ARRAY1D},
+               {"vertex.color", ANARI_ARRAY1D},
+               {"vertex.attribute0", ANARI_ARRAY1D},
+               {"vertex.attribute1", ANARI_ARRAY1D},
+               {"vertex.attribute2", ANARI_ARRAY1D},
+               {"vertex.attribute3", ANARI_ARRAY1D},
+               {"primitive.index", ANARI_ARRAY1D},
+               {"primitive.radius", ANARI_ARRAY1D},
+               {"radius", ANARI_FLOAT32},
+               {"caps", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8281,65 +9766,56 @@ static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "frame object";
+            static const char *description = "image2D object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"filter", ANARI_STRING},
                {"name", ANARI_STRING},
-               {"world", ANARI_WORLD},
-               {"renderer", ANARI_RENDERER},
-               {"camera", ANARI_CAMERA},
-               {"size", ANARI_UINT32_VEC2},
-               {"channel.color", ANARI_DATA_TYPE},
-               {"channel.depth", ANARI_DATA_TYPE},
-               {"channel.primitiveId", ANARI_DATA_TYPE},
-               {"channel.objectId", ANARI_DATA_TYPE},
-               {"channel.instanceId", ANARI_DATA_TYPE},
-               {"frameCompletionCallback", ANARI_FRAME_COMPLETION_CALLBACK},
-               {"frameCompletionCallbackUserData", ANARI_VOID_POINTER},
+               {"image", ANARI_ARRAY2D},
+               {"inAttribute", ANARI_STRING},
+               {"wrapMode1", ANARI_STRING},
+               {"wrapMode2", ANARI_STRING},
+               {"inTransform", ANARI_FLOAT32_MAT4},
+               {"inOffset", ANARI_FLOAT32_VEC4},
+               {"outTransform", ANARI_FLOAT32_MAT4},
+               {"outOffset", ANARI_FLOAT32_VEC4},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 10: // channel
-         if(infoType == ANARI_STRING_LIST) {
-            static const char *channel[] = {
-               "channel.color",
-               "channel.depth",
-               "channel.primitiveId",
-               "channel.objectId",
-               "channel.instanceId",
-               0
-            };
-            return channel;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image3D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "group object";
+            static const char *description = "image3D object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"filter", ANARI_STRING},
                {"name", ANARI_STRING},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
+               {"image", ANARI_ARRAY3D},
+               {"inAttribute", ANARI_STRING},
+               {"wrapMode1", ANARI_STRING},
+               {"wrapMode2", ANARI_STRING},
+               {"wrapMode3", ANARI_STRING},
+               {"inTransform", ANARI_FLOAT32_MAT4},
+               {"inOffset", ANARI_FLOAT32_VEC4},
+               {"outTransform", ANARI_FLOAT32_MAT4},
+               {"outOffset", ANARI_FLOAT32_VEC4},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8349,21 +9825,17 @@ static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "world object";
+            static const char *description = "one dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"instance", ANARI_ARRAY1D},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8373,20 +9845,17 @@ static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "surface object";
+            static const char *description = "two dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"geometry", ANARI_GEOMETRY},
-               {"material", ANARI_MATERIAL},
-               {"id", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8396,96 +9865,71 @@ static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_INSTANCE_transform_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "instance object";
+            static const char *description = "three dimensional array object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"transform", ANARI_FLOAT32_MAT4},
-               {"group", ANARI_GROUP},
-               {"id", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_INSTANCE_TRANSFORM";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 0;
-            return &value;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "orthographic camera object";
+            static const char *description = "surface object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"position", ANARI_FLOAT32_VEC3},
-               {"direction", ANARI_FLOAT32_VEC3},
-               {"up", ANARI_FLOAT32_VEC3},
-               {"imageRegion", ANARI_FLOAT32_BOX2},
-               {"aspect", ANARI_FLOAT32},
-               {"height", ANARI_FLOAT32},
-               {"near", ANARI_FLOAT32},
-               {"far", ANARI_FLOAT32},
+               {"geometry", ANARI_GEOMETRY},
+               {"material", ANARI_MATERIAL},
+               {"id", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 1;
-            return &value;
-         } else {
-            return nullptr;
-         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_compressedImage2D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "perspective camera object";
+            static const char *description = "compressed image2D object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"position", ANARI_FLOAT32_VEC3},
-               {"direction", ANARI_FLOAT32_VEC3},
-               {"up", ANARI_FLOAT32_VEC3},
-               {"imageRegion", ANARI_FLOAT32_BOX2},
-               {"fovy", ANARI_FLOAT32},
-               {"aspect", ANARI_FLOAT32},
-               {"near", ANARI_FLOAT32},
-               {"far", ANARI_FLOAT32},
+               {"image", ANARI_ARRAY1D},
+               {"format", ANARI_STRING},
+               {"size", ANARI_UINT64_VEC2},
+               {"inAttribute", ANARI_STRING},
+               {"filter", ANARI_STRING},
+               {"wrapMode1", ANARI_STRING},
+               {"wrapMode2", ANARI_STRING},
+               {"inTransform", ANARI_FLOAT32_MAT4},
+               {"inOffset", ANARI_FLOAT32_VEC4},
+               {"outTransform", ANARI_FLOAT32_MAT4},
+               {"outOffset", ANARI_FLOAT32_VEC4},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8494,10 +9938,10 @@ static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType in
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "EXT_SAMPLER_COMPRESSED_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 2;
+            static const int value = 0;
             return &value;
          } else {
             return nullptr;
@@ -8505,11 +9949,19 @@ static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType in
       default: return nullptr;
    }
 }
-static const void * ANARI_VOLUME__info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_INSTANCE_transform_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "instance object";
+            return description;
+         }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"transform", ANARI_FLOAT32_MAT4},
+               {"group", ANARI_GROUP},
                {"id", ANARI_UINT32},
                {0, ANARI_UNKNOWN}
             };
@@ -8519,10 +9971,10 @@ static const void * ANARI_VOLUME__info(int infoName, ANARIDataType infoType) {
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_FRAME_CHANNEL_OBJECT_ID";
+            static const char *extension = "KHR_INSTANCE_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 5;
+            static const int value = 4;
             return &value;
          } else {
             return nullptr;
@@ -8530,38 +9982,25 @@ static const void * ANARI_VOLUME__info(int infoName, ANARIDataType infoType) {
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cone_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "cone geometry object";
+            static const char *description = "orthographic camera object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"color", ANARI_FLOAT32_VEC4},
-               {"attribute0", ANARI_FLOAT32_VEC4},
-               {"attribute1", ANARI_FLOAT32_VEC4},
-               {"attribute2", ANARI_FLOAT32_VEC4},
-               {"attribute3", ANARI_FLOAT32_VEC4},
-               {"primitive.color", ANARI_ARRAY1D},
-               {"primitive.attribute0", ANARI_ARRAY1D},
-               {"primitive.attribute1", ANARI_ARRAY1D},
-               {"primitive.attribute2", ANARI_ARRAY1D},
-               {"primitive.attribute3", ANARI_ARRAY1D},
-               {"primitive.id", ANARI_ARRAY1D},
-               {"vertex.position", ANARI_ARRAY1D},
-               {"vertex.radius", ANARI_ARRAY1D},
-               {"vertex.cap", ANARI_ARRAY1D},
-               {"vertex.color", ANARI_ARRAY1D},
-               {"vertex.attribute0", ANARI_ARRAY1D},
-               {"vertex.attribute1", ANARI_ARRAY1D},
-               {"vertex.attribute2", ANARI_ARRAY1D},
-               {"vertex.attribute3", ANARI_ARRAY1D},
-               {"primitive.index", ANARI_ARRAY1D},
-               {"caps", ANARI_STRING},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"up", ANARI_FLOAT32_VEC3},
+               {"imageRegion", ANARI_FLOAT32_BOX2},
+               {"aspect", ANARI_FLOAT32},
+               {"height", ANARI_FLOAT32},
+               {"near", ANARI_FLOAT32},
+               {"far", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8570,10 +10009,10 @@ static const void * ANARI_GEOMETRY_cone_info(int infoName, ANARIDataType infoTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CONE";
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 8;
+            static const int value = 5;
             return &value;
          } else {
             return nullptr;
@@ -8581,37 +10020,25 @@ static const void * ANARI_GEOMETRY_cone_info(int infoName, ANARIDataType infoTyp
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_curve_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "curve geometry object";
+            static const char *description = "perspective camera object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"color", ANARI_FLOAT32_VEC4},
-               {"attribute0", ANARI_FLOAT32_VEC4},
-               {"attribute1", ANARI_FLOAT32_VEC4},
-               {"attribute2", ANARI_FLOAT32_VEC4},
-               {"attribute3", ANARI_FLOAT32_VEC4},
-               {"primitive.color", ANARI_ARRAY1D},
-               {"primitive.attribute0", ANARI_ARRAY1D},
-               {"primitive.attribute1", ANARI_ARRAY1D},
-               {"primitive.attribute2", ANARI_ARRAY1D},
-               {"primitive.attribute3", ANARI_ARRAY1D},
-               {"primitive.id", ANARI_ARRAY1D},
-               {"vertex.position", ANARI_ARRAY1D},
-               {"vertex.radius", ANARI_ARRAY1D},
-               {"vertex.color", ANARI_ARRAY1D},
-               {"vertex.attribute0", ANARI_ARRAY1D},
-               {"vertex.attribute1", ANARI_ARRAY1D},
-               {"vertex.attribute2", ANARI_ARRAY1D},
-               {"vertex.attribute3", ANARI_ARRAY1D},
-               {"primitive.index", ANARI_ARRAY1D},
-               {"radius", ANARI_FLOAT32},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"up", ANARI_FLOAT32_VEC3},
+               {"imageRegion", ANARI_FLOAT32_BOX2},
+               {"fovy", ANARI_FLOAT32},
+               {"aspect", ANARI_FLOAT32},
+               {"near", ANARI_FLOAT32},
+               {"far", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8620,10 +10047,10 @@ static const void * ANARI_GEOMETRY_curve_info(int infoName, ANARIDataType infoTy
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CURVE";
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 9;
+            static const int value = 6;
             return &value;
          } else {
             return nullptr;
@@ -8631,11 +10058,11 @@ static const void * ANARI_GEOMETRY_curve_info(int infoName, ANARIDataType infoTy
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "cylinder geometry object";
+            static const char *description = "curve geometry object";
             return description;
          }
       case 9: // parameter
@@ -8654,16 +10081,14 @@ static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType inf
                {"primitive.attribute3", ANARI_ARRAY1D},
                {"primitive.id", ANARI_ARRAY1D},
                {"vertex.position", ANARI_ARRAY1D},
-               {"vertex.cap", ANARI_ARRAY1D},
+               {"vertex.radius", ANARI_ARRAY1D},
                {"vertex.color", ANARI_ARRAY1D},
                {"vertex.attribute0", ANARI_ARRAY1D},
                {"vertex.attribute1", ANARI_ARRAY1D},
                {"vertex.attribute2", ANARI_ARRAY1D},
                {"vertex.attribute3", ANARI_ARRAY1D},
                {"primitive.index", ANARI_ARRAY1D},
-               {"primitive.radius", ANARI_ARRAY1D},
                {"radius", ANARI_FLOAT32},
-               {"caps", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -8672,10 +10097,10 @@ static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType inf
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 10;
+            static const int value = 14;
             return &value;
          } else {
             return nullptr;
@@ -8725,7 +10150,7 @@ static const void * ANARI_GEOMETRY_quad_info(int infoName, ANARIDataType infoTyp
             static const char *extension = "KHR_GEOMETRY_QUAD";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 11;
+            static const int value = 16;
             return &value;
          } else {
             return nullptr;
@@ -8775,7 +10200,7 @@ static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 12;
+            static const int value = 17;
             return &value;
          } else {
             return nullptr;
@@ -8825,7 +10250,7 @@ static const void * ANARI_GEOMETRY_triangle_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_GEOMETRY_TRIANGLE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 13;
+            static const int value = 18;
             return &value;
          } else {
             return nullptr;
@@ -8863,7 +10288,7 @@ static const void * ANARI_MATERIAL_matte_info(int infoName, ANARIDataType infoTy
             static const char *extension = "KHR_MATERIAL_MATTE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 14;
+            static const int value = 19;
             return &value;
          } else {
             return nullptr;
@@ -8901,86 +10326,7 @@ static const void * ANARI_SAMPLER_image1D_info(int infoName, ANARIDataType infoT
             static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 18;
-            return &value;
-         } else {
-            return nullptr;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_image2D_info(int infoName, ANARIDataType infoType) {
-   switch(infoName) {
-      case 4: // description
-         {
-            static const char *description = "image2D object";
-            return description;
-         }
-      case 9: // parameter
-         if(infoType == ANARI_PARAMETER_LIST) {
-            static const ANARIParameter parameters[] = {
-               {"name", ANARI_STRING},
-               {"image", ANARI_ARRAY2D},
-               {"inAttribute", ANARI_STRING},
-               {"filter", ANARI_STRING},
-               {"wrapMode1", ANARI_STRING},
-               {"wrapMode2", ANARI_STRING},
-               {"inTransform", ANARI_FLOAT32_MAT4},
-               {"inOffset", ANARI_FLOAT32_VEC4},
-               {"outTransform", ANARI_FLOAT32_MAT4},
-               {"outOffset", ANARI_FLOAT32_VEC4},
-               {0, ANARI_UNKNOWN}
-            };
-            return parameters;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE2D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 19;
-            return &value;
-         } else {
-            return nullptr;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SAMPLER_image3D_info(int infoName, ANARIDataType infoType) {
-   switch(infoName) {
-      case 4: // description
-         {
-            static const char *description = "image3D object";
-            return description;
-         }
-      case 9: // parameter
-         if(infoType == ANARI_PARAMETER_LIST) {
-            static const ANARIParameter parameters[] = {
-               {"name", ANARI_STRING},
-               {"image", ANARI_ARRAY3D},
-               {"inAttribute", ANARI_STRING},
-               {"filter", ANARI_STRING},
-               {"wrapMode1", ANARI_STRING},
-               {"wrapMode2", ANARI_STRING},
-               {"wrapMode3", ANARI_STRING},
-               {"inTransform", ANARI_FLOAT32_MAT4},
-               {"inOffset", ANARI_FLOAT32_VEC4},
-               {"outTransform", ANARI_FLOAT32_MAT4},
-               {"outOffset", ANARI_FLOAT32_VEC4},
-               {0, ANARI_UNKNOWN}
-            };
-            return parameters;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SAMPLER_IMAGE3D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 20;
+            static const int value = 23;
             return &value;
          } else {
             return nullptr;
@@ -9012,7 +10358,7 @@ static const void * ANARI_SAMPLER_primitive_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_SAMPLER_PRIMITIVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 21;
+            static const int value = 26;
             return &value;
          } else {
             return nullptr;
@@ -9045,80 +10391,7 @@ static const void * ANARI_SAMPLER_transform_info(int infoName, ANARIDataType inf
             static const char *extension = "KHR_SAMPLER_TRANSFORM";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 22;
-            return &value;
-         } else {
-            return nullptr;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANARIDataType infoType) {
-   switch(infoName) {
-      case 4: // description
-         {
-            static const char *description = "structured regular spatial field object";
-            return description;
-         }
-      case 9: // parameter
-         if(infoType == ANARI_PARAMETER_LIST) {
-            static const ANARIParameter parameters[] = {
-               {"name", ANARI_STRING},
-               {"data", ANARI_ARRAY3D},
-               {"origin", ANARI_FLOAT32_VEC3},
-               {"spacing", ANARI_FLOAT32_VEC3},
-               {"filter", ANARI_STRING},
-               {0, ANARI_UNKNOWN}
-            };
-            return parameters;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 23;
-            return &value;
-         } else {
-            return nullptr;
-         }
-      default: return nullptr;
-   }
-}
-static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIDataType infoType) {
-   switch(infoName) {
-      case 4: // description
-         {
-            static const char *description = "transferFunction1D volume object";
-            return description;
-         }
-      case 9: // parameter
-         if(infoType == ANARI_PARAMETER_LIST) {
-            static const ANARIParameter parameters[] = {
-               {"name", ANARI_STRING},
-               {"value", ANARI_SPATIAL_FIELD},
-               {"valueRange", ANARI_FLOAT32_BOX1},
-               {"valueRange", ANARI_FLOAT64_BOX1},
-               {"color", ANARI_FLOAT32_VEC4},
-               {"color", ANARI_FLOAT32_VEC3},
-               {"color", ANARI_ARRAY1D},
-               {"opacity", ANARI_FLOAT32},
-               {"opacity", ANARI_ARRAY1D},
-               {"unitDistance", ANARI_FLOAT32},
-               {0, ANARI_UNKNOWN}
-            };
-            return parameters;
-         } else {
-            return nullptr;
-         }
-      case 7: // sourceExtension
-         if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
-            return extension;
-         } else if(infoType == ANARI_INT32) {
-            static const int value = 24;
+            static const int value = 27;
             return &value;
          } else {
             return nullptr;
@@ -9140,10 +10413,10 @@ static const void * ANARI_GEOMETRY_info(const char *subtype, int infoName, ANARI
    switch(subtype_hash(subtype)) {
       case 1:
          return ANARI_GEOMETRY_cone_info(infoName, infoType);
-      case 2:
-         return ANARI_GEOMETRY_curve_info(infoName, infoType);
       case 3:
          return ANARI_GEOMETRY_cylinder_info(infoName, infoType);
+      case 2:
+         return ANARI_GEOMETRY_curve_info(infoName, infoType);
       case 12:
          return ANARI_GEOMETRY_quad_info(infoName, infoType);
       case 13:
@@ -9180,12 +10453,14 @@ static const void * ANARI_RENDERER_info(const char *subtype, int infoName, ANARI
 }
 static const void * ANARI_SAMPLER_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 5:
-         return ANARI_SAMPLER_image1D_info(infoName, infoType);
       case 6:
          return ANARI_SAMPLER_image2D_info(infoName, infoType);
       case 7:
          return ANARI_SAMPLER_image3D_info(infoName, infoType);
+      case 0:
+         return ANARI_SAMPLER_compressedImage2D_info(infoName, infoType);
+      case 5:
+         return ANARI_SAMPLER_image1D_info(infoName, infoType);
       case 11:
          return ANARI_SAMPLER_primitive_info(infoName, infoType);
       case 16:
@@ -9204,8 +10479,6 @@ static const void * ANARI_SPATIAL_FIELD_info(const char *subtype, int infoName,
 }
 static const void * ANARI_VOLUME_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 0:
-         return ANARI_VOLUME__info(infoName, infoType);
       case 15:
          return ANARI_VOLUME_transferFunction1D_info(infoName, infoType);
       default:
@@ -9232,18 +10505,18 @@ const void * query_object_info_enum(ANARIDataType type, const char *subtype, int
          return ANARI_VOLUME_info(subtype, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_info(infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_info(infoName, infoType);
+      case ANARI_WORLD:
+         return ANARI_WORLD_info(infoName, infoType);
+      case ANARI_GROUP:
+         return ANARI_GROUP_info(infoName, infoType);
       case ANARI_ARRAY1D:
          return ANARI_ARRAY1D_info(infoName, infoType);
       case ANARI_ARRAY2D:
          return ANARI_ARRAY2D_info(infoName, infoType);
       case ANARI_ARRAY3D:
          return ANARI_ARRAY3D_info(infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_info(infoName, infoType);
-      case ANARI_GROUP:
-         return ANARI_GROUP_info(infoName, infoType);
-      case ANARI_WORLD:
-         return ANARI_WORLD_info(infoName, infoType);
       case ANARI_SURFACE:
          return ANARI_SURFACE_info(infoName, infoType);
       default:
@@ -9,18 +9,37 @@
 #include "helium/BaseGlobalDeviceState.h"
 // embree
 #include "embree3/rtcore.h"
+// std
+#include <atomic>
+#include <string>
 
 namespace helide {
 
+struct BVHSettings
+{
+  RTCBuildQuality quality{RTC_BUILD_QUALITY_MEDIUM};
+  RTCSceneFlags flags{RTC_SCENE_FLAG_NONE};
+};
+
 struct Frame;
 
 struct HelideGlobalState : public helium::BaseGlobalDeviceState
 {
-  int numThreads{1};
+  // Embree device configuration, only used when the device is initialized
+  struct EmbreeConfig
+  {
+    int numThreads{0}; // 0 == use all cores
+    bool setAffinity{false};
+    std::string isa{"default"};
+  } embreeConfig;
+
+  uint64_t embreeMemoryLimit{0}; // 0 == unlimited
+  std::atomic<int64_t> embreeMemoryUsed{0};
 
   struct ObjectUpdates
   {
     helium::TimeStamp lastBLSReconstructSceneRequest{0};
+    helium::TimeStamp lastBLSReconstructAllRequest{0}; // every Group rebuilds
     helium::TimeStamp lastBLSCommitSceneRequest{0};
     helium::TimeStamp lastTLSReconstructSceneRequest{0};
   } objectUpdates;
@@ -31,6 +50,8 @@ struct HelideGlobalState : public helium::BaseGlobalDeviceState
   anari::Device anariDevice{nullptr}; // public handle of _this_ helide instance
   RTCDevice embreeDevice{nullptr};
 
+  BVHSettings groupBVHDefaults;
+
   bool allowInvalidSurfaceMaterials{true};
   float4 invalidMaterialColor{1.f, 0.f, 1.f, 1.f};
 
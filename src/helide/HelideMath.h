@@ -13,7 +13,9 @@ namespace helide {
 using namespace anari::math;
 using namespace helium::math;
 
-struct Ray
+// Aligned like RTCRayHit, which embree requires of every ray it is handed,
+// including each element of the arrays passed to rtcIntersect1M()
+struct alignas(16) Ray
 {
   // Ray //
 
@@ -34,6 +36,11 @@ struct Ray
   unsigned int primID{RTC_INVALID_GEOMETRY_ID}; // primitive ID
   unsigned int geomID{RTC_INVALID_GEOMETRY_ID}; // geometry ID
   unsigned int instID{RTC_INVALID_GEOMETRY_ID}; // instance ID
+
+  // Pixel footprint, past the RTCRayHit layout so embree never sees it //
+
+  float coneWidth{0.f}; // footprint width at the origin
+  float coneSpread{0.f}; // footprint growth per unit of distance
 };
 
 struct Volume;
@@ -46,4 +53,27 @@ struct VolumeRay
   uint32_t instID{RTC_INVALID_GEOMETRY_ID};
 };
 
+// Functions //////////////////////////////////////////////////////////////////
+
+inline uint32_t hashCombine(uint32_t h, uint32_t v)
+{
+  h ^= v + 0x9e3779b9u + (h << 6) + (h >> 2);
+  h ^= h >> 16;
+  h *= 0x7feb352du;
+  h ^= h >> 15;
+  h *= 0x846ca68bu;
+  h ^= h >> 16;
+  return h;
+}
+
+// Slab test of a ray against a box, an empty range is returned on a miss
+inline box1 intersectBox(const box3 &b, const float3 &org, const float3 &dir)
+{
+  const float3 mins = (b.lower - org) * (1.f / dir);
+  const float3 maxs = (b.upper - org) * (1.f / dir);
+  const float3 nears = linalg::min(mins, maxs);
+  const float3 fars = linalg::max(mins, maxs);
+  return box1(linalg::maxelem(nears), linalg::minelem(fars));
+}
+
 } // namespace helide
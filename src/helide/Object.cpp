@@ -40,6 +40,59 @@ HelideGlobalState *Object::deviceState() const
   return (HelideGlobalState *)helium::BaseObject::m_state;
 }
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+static RTCBuildQuality buildQualityFromString(
+    const std::string &name, RTCBuildQuality defaultQuality)
+{
+  if (name == "low")
+    return RTC_BUILD_QUALITY_LOW;
+  else if (name == "medium")
+    return RTC_BUILD_QUALITY_MEDIUM;
+  else if (name == "high")
+    return RTC_BUILD_QUALITY_HIGH;
+  else
+    return defaultQuality;
+}
+
+BVHSettings bvhSettingsFromParams(
+    helium::ParameterizedObject &o, const BVHSettings &defaults)
+{
+  BVHSettings retval;
+  retval.quality = buildQualityFromString(
+      o.getParamString("bvh.buildQuality", ""), defaults.quality);
+
+  auto flag = [&](const char *name, RTCSceneFlags f) {
+    const bool defaultValue = (defaults.flags & f) != 0;
+    return o.getParam<bool>(name, defaultValue) ? f : RTC_SCENE_FLAG_NONE;
+  };
+
+  retval.flags = RTCSceneFlags(flag("bvh.dynamic", RTC_SCENE_FLAG_DYNAMIC)
+      | flag("bvh.compact", RTC_SCENE_FLAG_COMPACT)
+      | flag("bvh.robust", RTC_SCENE_FLAG_ROBUST));
+
+  return retval;
+}
+
+void applyBVHSettings(RTCScene scene, const BVHSettings &settings)
+{
+  rtcSetSceneFlags(scene, settings.flags);
+  rtcSetSceneBuildQuality(scene, settings.quality);
+}
+
+const char *buildQualityToString(RTCBuildQuality quality)
+{
+  switch (quality) {
+  case RTC_BUILD_QUALITY_LOW:
+    return "low";
+  case RTC_BUILD_QUALITY_HIGH:
+    return "high";
+  case RTC_BUILD_QUALITY_MEDIUM:
+  default:
+    return "medium";
+  }
+}
+
 // UnknownObject definitions //////////////////////////////////////////////////
 
 UnknownObject::UnknownObject(ANARIDataType type, HelideGlobalState *s)
@@ -8,6 +8,7 @@
 // helium
 #include "helium/BaseObject.h"
 #include "helium/utility/ChangeObserverPtr.h"
+#include "helium/utility/ParameterizedObject.h"
 // std
 #include <string_view>
 
@@ -37,6 +38,15 @@ struct UnknownObject : public Object
   bool isValid() const override;
 };
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Read "bvh.buildQuality" + "bvh.{dynamic,compact,robust}", falling back to
+// 'defaults' for anything that isn't set
+BVHSettings bvhSettingsFromParams(
+    helium::ParameterizedObject &o, const BVHSettings &defaults);
+void applyBVHSettings(RTCScene scene, const BVHSettings &settings);
+const char *buildQualityToString(RTCBuildQuality quality);
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_SPECIALIZATION(helide::Object *, ANARI_OBJECT);
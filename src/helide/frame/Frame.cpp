@@ -5,6 +5,7 @@
 // std
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <random>
 // embree
 #include "algorithms/parallel_for.h"
@@ -13,13 +14,6 @@ namespace helide {
 
 // Helper functions ///////////////////////////////////////////////////////////
 
-template <typename I, typename FUNC>
-static void serial_for(I size, FUNC &&f)
-{
-  for (I i = 0; i < size; i++)
-    f(i);
-}
-
 template <typename R, typename TASK_T>
 static std::future<R> async(std::packaged_task<R()> &task, TASK_T &&fcn)
 {
@@ -36,6 +30,137 @@ static bool is_ready(const std::future<R> &f)
       || f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
 }
 
+static uint32_t spreadBits(uint32_t v)
+{
+  v &= 0x0000ffff;
+  v = (v | (v << 8)) & 0x00ff00ff;
+  v = (v | (v << 4)) & 0x0f0f0f0f;
+  v = (v | (v << 2)) & 0x33333333;
+  v = (v | (v << 1)) & 0x55555555;
+  return v;
+}
+
+static uint32_t mortonCode(uint32_t x, uint32_t y)
+{
+  return spreadBits(x) | (spreadBits(y) << 1);
+}
+
+// Color channel conversion, written as plain loops over SoA rows so the
+// compiler can vectorize them
+
+static void convertRowFloat4(float *dst,
+    const float *r,
+    const float *g,
+    const float *b,
+    const float *a,
+    uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++) {
+    dst[4 * i + 0] = r[i];
+    dst[4 * i + 1] = g[i];
+    dst[4 * i + 2] = b[i];
+    dst[4 * i + 3] = a[i];
+  }
+}
+
+static uint32_t unorm8(float v)
+{
+  return static_cast<uint32_t>(255.f * std::clamp(v, 0.f, 1.f));
+}
+
+static void convertRowUnorm8(uint32_t *dst,
+    const float *r,
+    const float *g,
+    const float *b,
+    const float *a,
+    uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++) {
+    dst[i] = unorm8(r[i]) | (unorm8(g[i]) << 8) | (unorm8(b[i]) << 16)
+        | (unorm8(a[i]) << 24);
+  }
+}
+
+// Lookup table replacing helium::math::cvt_color_to_uint32_srgb()'s per
+// channel std::pow(). It is indexed by the exponent and top mantissa bits of
+// the linear value, which keeps it within 1 LSB of the exact result.
+struct SrgbTable
+{
+  static constexpr int MANTISSA_BITS = 10;
+  static constexpr int MIN_EXPONENT = -20; // everything below maps to 0
+  static constexpr int NUM_EXPONENTS = -MIN_EXPONENT;
+  static constexpr uint32_t SIZE = NUM_EXPONENTS << MANTISSA_BITS;
+  static constexpr uint32_t MIN_BITS = uint32_t(127 + MIN_EXPONENT) << 23;
+  static constexpr uint32_t ONE_BITS = 127u << 23;
+
+  SrgbTable()
+  {
+    for (uint32_t i = 0; i < SIZE; i++) {
+      // evaluate at the center of each bucket
+      const uint32_t bits =
+          MIN_BITS + (i << (23 - MANTISSA_BITS)) + (1u << (22 - MANTISSA_BITS));
+      float v = 0.f;
+      std::memcpy(&v, &bits, sizeof(v));
+      values[i] = uint8_t(unorm8(helium::math::toneMap(v)));
+    }
+  }
+
+  uint32_t operator()(float v) const
+  {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    // negative values and NaNs have bits above ONE_BITS too, so test sign first
+    if (int32_t(bits) < int32_t(MIN_BITS))
+      return 0;
+    if (bits >= ONE_BITS)
+      return 255;
+    return values[(bits - MIN_BITS) >> (23 - MANTISSA_BITS)];
+  }
+
+  uint8_t values[SIZE];
+};
+
+static void convertRowSrgb8(uint32_t *dst,
+    const float *r,
+    const float *g,
+    const float *b,
+    const float *a,
+    uint32_t n)
+{
+  static const SrgbTable srgb;
+  for (uint32_t i = 0; i < n; i++) {
+    dst[i] = srgb(r[i]) | (srgb(g[i]) << 8) | (srgb(b[i]) << 16)
+        | (unorm8(a[i]) << 24);
+  }
+}
+
+using Clock = std::chrono::steady_clock;
+
+static uint64_t nanosecondsSince(Clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      Clock::now() - start)
+      .count();
+}
+
+static float seconds(uint64_t ns)
+{
+  return ns * 1e-9f;
+}
+
+static float luminance(const float4 &c)
+{
+  return 0.2126f * c.x + 0.7152f * c.y + 0.0722f * c.z;
+}
+
+static float2 pixelJitter(uint32_t x, uint32_t y, uint32_t frame, uint32_t i)
+{
+  const uint32_t h =
+      hashCombine(hashCombine(hashCombine(hashCombine(0u, x), y), frame), i);
+  const uint32_t h2 = hashCombine(h, 0x68e31da4u);
+  return float2((h >> 8) * (1.f / 16777216.f), (h2 >> 8) * (1.f / 16777216.f));
+}
+
 // Frame definitions //////////////////////////////////////////////////////////
 
 Frame::Frame(HelideGlobalState *s) : helium::BaseFrame(s) {}
@@ -88,25 +213,28 @@ void Frame::commit()
   m_frameData.size = getParam<uint2>("size", uint2(10));
   m_frameData.invSize = 1.f / float2(m_frameData.size);
 
+  m_tileSize = std::max(getParam<uint32_t>("tileSize", 16u), 1u);
+  buildTiles();
+
+  m_accumulate = getParam<bool>("accumulation", false);
+  m_varianceThreshold = getParam<float>("varianceThreshold", 0.f);
+  if (m_varianceThreshold > 0.f && !m_accumulate) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'varianceThreshold' on frame is ignored without 'accumulation'");
+  }
+  m_timeBudget = getParam<float>("timeBudget", 0.f);
+
   const auto numPixels = m_frameData.size.x * m_frameData.size.y;
 
+  m_accumBuffer.resize(m_accumulate ? numPixels : 0);
+  m_accumLumSqBuffer.resize(m_accumulate ? numPixels : 0);
+
   m_perPixelBytes = 4 * (m_colorType == ANARI_FLOAT32_VEC4 ? 4 : 1);
-  m_pixelBuffer.resize(numPixels * m_perPixelBytes);
 
-  m_depthBuffer.resize(m_depthType == ANARI_FLOAT32 ? numPixels : 0);
+  // framebuffers are resized lazily when next rendered into
+  m_completedBuffer = -1;
   m_frameChanged = true;
 
-  m_primIdBuffer.clear();
-  m_objIdBuffer.clear();
-  m_instIdBuffer.clear();
-
-  if (m_primIdType == ANARI_UINT32)
-    m_primIdBuffer.resize(numPixels);
-  if (m_objIdType == ANARI_UINT32)
-    m_objIdBuffer.resize(numPixels);
-  if (m_instIdType == ANARI_UINT32)
-    m_instIdBuffer.resize(numPixels);
-
   m_callback = getParam<ANARIFrameCompletionCallback>(
       "frameCompletionCallback", nullptr);
   m_callbackUserPtr =
@@ -119,6 +247,36 @@ bool Frame::getProperty(
   if (type == ANARI_FLOAT32 && name == "duration") {
     helium::writeToVoidP(ptr, m_duration);
     return true;
+  } else if (type == ANARI_FLOAT32 && name == "variance") {
+    helium::writeToVoidP(ptr, m_variance);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.commitFlush") {
+    helium::writeToVoidP(ptr, m_stats.commitFlush);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.blsRebuild") {
+    helium::writeToVoidP(ptr, m_stats.blsRebuild);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.blsCommit") {
+    helium::writeToVoidP(ptr, m_stats.blsCommit);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "duration.tlsRebuild") {
+    helium::writeToVoidP(ptr, m_stats.tlsRebuild);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "threadTime.trace") {
+    helium::writeToVoidP(ptr, m_stats.trace);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "threadTime.shade") {
+    helium::writeToVoidP(ptr, m_stats.shade);
+    return true;
+  } else if (type == ANARI_FLOAT32 && name == "threadTime.write") {
+    helium::writeToVoidP(ptr, m_stats.write);
+    return true;
+  } else if (type == ANARI_UINT64 && name == "raysTraced") {
+    helium::writeToVoidP(ptr, m_stats.raysTraced);
+    return true;
+  } else if (type == ANARI_UINT64 && name == "volumeSamples") {
+    helium::writeToVoidP(ptr, m_stats.volumeSamples);
+    return true;
   }
 
   return 0;
@@ -132,40 +290,110 @@ void Frame::renderFrame()
   state->waitOnCurrentFrame();
   state->currentFrame = this;
 
+  m_renderBuffer = nextRenderBuffer();
+  m_cancelRender = false;
+
   m_future = async<void>(m_task, [&, state]() {
     auto start = std::chrono::steady_clock::now();
     state->renderingSemaphore.frameStart();
     state->commitBufferFlush();
+    m_stats = {};
+    m_stats.commitFlush = seconds(nanosecondsSince(start));
+
+    auto &fb = m_buffers[m_renderBuffer];
+    resizeFrameBuffers(fb);
 
     if (!isValid()) {
       reportMessage(
           ANARI_SEVERITY_ERROR, "skipping render of incomplete frame object");
-      std::fill(m_pixelBuffer.begin(), m_pixelBuffer.end(), 0);
+      std::fill(fb.color.begin(), fb.color.end(), 0);
+      m_completedBuffer = m_renderBuffer;
       state->renderingSemaphore.frameEnd();
       return;
     }
 
-    if (state->commitBufferLastFlush() <= m_frameLastRendered) {
+    const bool sceneChanged =
+        m_frameChanged || state->commitBufferLastFlush() > m_frameLastRendered;
+
+    // tiles left stale by an earlier time-budgeted frame still need a render
+    const bool tilesStale = std::any_of(m_tiles.begin(),
+        m_tiles.end(),
+        [](const Tile &tile) { return tile.stale; });
+
+    if (!sceneChanged && !tilesStale && !m_accumulate
+        && m_completedBuffer >= 0) {
       state->renderingSemaphore.frameEnd();
       return;
     }
 
+    if (sceneChanged) {
+      m_frameData.frameID = 0;
+      for (auto &tile : m_tiles) {
+        tile.accumFrames = 0;
+        tile.stale = true;
+      }
+    }
+
+    m_frameChanged = false;
     m_frameLastRendered = helium::newTimeStamp();
 
     m_world->embreeSceneUpdate();
-
-    const auto &size = m_frameData.size;
-    embree::parallel_for(size.y, [&](int y) {
-      serial_for(size.x, [&](int x) {
-        auto screen = screenFromPixel(float2(x, y));
-        auto imageRegion = m_camera->imageRegion();
-        screen.x = linalg::lerp(imageRegion.x, imageRegion.z, screen.x);
-        screen.y = linalg::lerp(imageRegion.y, imageRegion.w, screen.y);
-        Ray ray = m_camera->createRay(screen);
-        writeSample(x, y, m_renderer->renderSample(screen, ray, *m_world));
-      });
+    const auto &updateTimes = m_world->lastUpdateTimes();
+    m_stats.blsRebuild = updateTimes.blsRebuild;
+    m_stats.blsCommit = updateTimes.blsCommit;
+    m_stats.tlsRebuild = updateTimes.tlsRebuild;
+
+    m_tileCounters.traceNs = 0;
+    m_tileCounters.shadeNs = 0;
+    m_tileCounters.writeNs = 0;
+    m_tileCounters.raysTraced = 0;
+    m_tileCounters.volumeSamples = 0;
+
+    const int prevBuffer = m_completedBuffer;
+    const auto deadline =
+        start + std::chrono::duration<float>(std::max(m_timeBudget, 0.f));
+    embree::parallel_for(m_tiles.size(), [&](size_t i) {
+      // a cancelled frame is only presented when there is no previous one
+      const bool cancelled = m_cancelRender;
+      if (cancelled && prevBuffer >= 0)
+        return;
+      auto &tile = m_tiles[i];
+      const bool converged = tile.accumFrames > 1 && prevBuffer >= 0
+          && m_varianceThreshold > 0.f && tile.variance <= m_varianceThreshold;
+      const bool current = !m_accumulate && !tile.stale;
+      const bool outOfTime = m_timeBudget > 0.f
+          && std::chrono::steady_clock::now() > deadline;
+      // skipped tiles only reuse the previous frame when it shows the same
+      // scene, otherwise one image would mix tiles of two different scenes
+      if (!cancelled && !converged && !current && !outOfTime) {
+        renderTile(tile);
+        tile.stale = false;
+      } else if (tile.stale || prevBuffer < 0) {
+        clearTile(tile);
+      } else if (prevBuffer != m_renderBuffer) {
+        copyTile(tile, m_buffers[prevBuffer]);
+      }
     });
 
+    m_stats.trace = seconds(m_tileCounters.traceNs);
+    m_stats.shade = seconds(m_tileCounters.shadeNs);
+    m_stats.write = seconds(m_tileCounters.writeNs);
+    m_stats.raysTraced = m_tileCounters.raysTraced;
+    m_stats.volumeSamples = m_tileCounters.volumeSamples;
+
+    m_frameData.frameID++;
+
+    // a discarded frame is incomplete, keep presenting the previous one and
+    // render the whole scene again next time
+    if (!m_cancelRender || prevBuffer < 0)
+      m_completedBuffer = m_renderBuffer;
+    if (m_cancelRender)
+      m_frameChanged = true;
+
+    m_variance = 0.f;
+    for (const auto &tile : m_tiles)
+      m_variance = std::max(m_variance, tile.variance);
+
     if (m_callback)
       m_callback(m_callbackUserPtr, state->anariDevice, (ANARIFrame)this);
 
@@ -183,30 +411,41 @@ void *Frame::map(std::string_view channel,
 {
   wait();
 
+  if (m_completedBuffer < 0) {
+    m_completedBuffer = nextRenderBuffer();
+    resizeFrameBuffers(m_buffers[m_completedBuffer]);
+  }
+
+  auto &fb = m_buffers[m_completedBuffer];
+
   *width = m_frameData.size.x;
   *height = m_frameData.size.y;
 
+  void *retval = nullptr;
+
   if (channel == "channel.color") {
     *pixelType = m_colorType;
-    return m_pixelBuffer.data();
-  } else if (channel == "channel.depth" && !m_depthBuffer.empty()) {
+    retval = fb.color.data();
+  } else if (channel == "channel.depth" && !fb.depth.empty()) {
     *pixelType = ANARI_FLOAT32;
-    return m_depthBuffer.data();
-  } else if (channel == "channel.primitiveId" && !m_primIdBuffer.empty()) {
+    retval = fb.depth.data();
+  } else if (channel == "channel.primitiveId" && !fb.primId.empty()) {
     *pixelType = ANARI_UINT32;
-    return m_primIdBuffer.data();
-  } else if (channel == "channel.objectId" && !m_objIdBuffer.empty()) {
+    retval = fb.primId.data();
+  } else if (channel == "channel.objectId" && !fb.objId.empty()) {
     *pixelType = ANARI_UINT32;
-    return m_objIdBuffer.data();
-  } else if (channel == "channel.instanceId" && !m_instIdBuffer.empty()) {
+    retval = fb.objId.data();
+  } else if (channel == "channel.instanceId" && !fb.instId.empty()) {
     *pixelType = ANARI_UINT32;
-    return m_instIdBuffer.data();
+    retval = fb.instId.data();
   } else {
     *width = 0;
     *height = 0;
     *pixelType = ANARI_UNKNOWN;
     return nullptr;
   }
+
+  return retval;
 }
 
 void Frame::unmap(std::string_view channel)
@@ -226,7 +465,8 @@ int Frame::frameReady(ANARIWaitMask m)
 
 void Frame::discard()
 {
-  // no-op
+  if (!ready())
+    m_cancelRender = true;
 }
 
 bool Frame::ready() const
@@ -244,41 +484,294 @@ void Frame::wait() const
   }
 }
 
+void Frame::buildTiles()
+{
+  const auto &size = m_frameData.size;
+  const uint2 numTiles = (size + (m_tileSize - 1)) / m_tileSize;
+
+  m_tiles.clear();
+  m_tiles.reserve(size_t(numTiles.x) * numTiles.y);
+
+  for (uint32_t ty = 0; ty < numTiles.y; ty++) {
+    for (uint32_t tx = 0; tx < numTiles.x; tx++) {
+      Tile t;
+      t.lower = uint2(tx, ty) * m_tileSize;
+      t.upper = linalg::min(t.lower + m_tileSize, size);
+      m_tiles.push_back(t);
+    }
+  }
+
+  std::sort(m_tiles.begin(), m_tiles.end(), [&](const Tile &a, const Tile &b) {
+    return mortonCode(a.lower.x / m_tileSize, a.lower.y / m_tileSize)
+        < mortonCode(b.lower.x / m_tileSize, b.lower.y / m_tileSize);
+  });
+}
+
+void Frame::renderTile(Tile &tile)
+{
+  thread_local std::vector<Ray> rays;
+  thread_local std::vector<float2> screens;
+  thread_local std::vector<PixelSample> samples;
+  thread_local std::vector<PixelSample> shaded;
+  thread_local TileSamples resolved;
+
+  const uint2 tileSize = tile.upper - tile.lower;
+  const uint32_t numPixels = tileSize.x * tileSize.y;
+  rays.resize(numPixels);
+  screens.resize(numPixels);
+  samples.resize(numPixels);
+  resolved.resize(numPixels);
+
+  const auto imageRegion = m_camera->imageRegion();
+  const uint32_t frameID = m_frameData.frameID;
+  const uint32_t spp = m_renderer->pixelSamples();
+  const bool jitter = m_accumulate || spp > 1;
+  shaded.resize(spp > 1 ? numPixels : 0);
+
+  const auto regionScreen = [&](const float2 &pixel) {
+    auto screen = screenFromPixel(pixel);
+    screen.x = linalg::lerp(imageRegion.x, imageRegion.z, screen.x);
+    screen.y = linalg::lerp(imageRegion.y, imageRegion.w, screen.y);
+    return screen;
+  };
+
+  // One pixel's ray cone, taken at the tile center, lets samplers pick a mip
+  // level without tracing differential rays
+  const float2 center = float2(tile.lower + tile.upper) * 0.5f;
+  const auto r0 = m_camera->createRay(regionScreen(center));
+  const auto r1 = m_camera->createRay(regionScreen(center + float2(0.f, 1.f)));
+  const float coneWidth = linalg::length(r1.org - r0.org);
+  const float coneSpread = linalg::length(r1.dir - r0.dir);
+
+  uint64_t traceNs = 0;
+  uint64_t shadeNs = 0;
+  uint64_t volumeSamples = 0;
+
+  for (uint32_t s = 0; s < spp; s++) {
+    // Generate all primary rays of the tile for this sample //
+
+    for (uint32_t i = 0, y = tile.lower.y; y < tile.upper.y; y++) {
+      for (uint32_t x = tile.lower.x; x < tile.upper.x; x++, i++) {
+        const float2 offset =
+            jitter ? pixelJitter(x, y, frameID, s) : float2(0.f);
+        const auto screen = regionScreen(float2(x, y) + offset);
+        screens[i] = screen;
+        rays[i] = m_camera->createRay(screen);
+        rays[i].coneWidth = coneWidth;
+        rays[i].coneSpread = coneSpread;
+      }
+    }
+
+    // Trace, then shade //
+
+    auto t0 = Clock::now();
+    m_renderer->intersectSurfaces(rays.data(), numPixels, *m_world);
+    traceNs += nanosecondsSince(t0);
+
+    t0 = Clock::now();
+    auto &dst = s == 0 ? samples : shaded;
+    m_renderer->shadeSamples(
+        screens.data(), rays.data(), numPixels, *m_world, dst.data());
+    for (uint32_t i = 0; i < numPixels; i++) {
+      volumeSamples += dst[i].volumeSamples;
+      if (s != 0)
+        samples[i].color += dst[i].color;
+    }
+    shadeNs += nanosecondsSince(t0);
+  }
+
+  m_tileCounters.traceNs += traceNs;
+  m_tileCounters.shadeNs += shadeNs;
+  m_tileCounters.raysTraced += uint64_t(numPixels) * spp;
+  m_tileCounters.volumeSamples += volumeSamples;
+
+  // Resolve into the frame buffers //
+
+  const float invSpp = 1.f / spp;
+  const uint32_t accumFrames = tile.accumFrames;
+  const float invNumFrames = 1.f / (accumFrames + 1);
+  float tileVariance = 0.f;
+  for (uint32_t i = 0, y = tile.lower.y; y < tile.upper.y; y++) {
+    for (uint32_t x = tile.lower.x; x < tile.upper.x; x++, i++) {
+      auto &sample = samples[i];
+      sample.color *= invSpp;
+      if (m_accumulate) {
+        const auto idx = y * m_frameData.size.x + x;
+        const float lum = luminance(sample.color);
+        auto &accum = m_accumBuffer[idx];
+        auto &accumLumSq = m_accumLumSqBuffer[idx];
+        accum = accumFrames == 0 ? sample.color : accum + sample.color;
+        accumLumSq = accumFrames == 0 ? lum * lum : accumLumSq + lum * lum;
+        sample.color = accum * invNumFrames;
+
+        // variance of the running mean: (E[x^2] - E[x]^2) / N
+        const float mean = luminance(sample.color);
+        const float var = accumLumSq * invNumFrames - mean * mean;
+        tileVariance += std::max(var, 0.f) * invNumFrames;
+      }
+      resolved.r[i] = sample.color.x;
+      resolved.g[i] = sample.color.y;
+      resolved.b[i] = sample.color.z;
+      resolved.a[i] = sample.color.w;
+      resolved.depth[i] = sample.depth;
+      resolved.primId[i] = sample.primId;
+      resolved.objId[i] = sample.objId;
+      resolved.instId[i] = sample.instId;
+    }
+  }
+
+  const auto writeStart = Clock::now();
+  writeTile(tile, resolved);
+  m_tileCounters.writeNs += nanosecondsSince(writeStart);
+
+  if (m_accumulate)
+    tile.accumFrames++;
+
+  tile.variance = m_accumulate && accumFrames > 0
+      ? tileVariance / numPixels
+      : std::numeric_limits<float>::infinity();
+}
+
 float2 Frame::screenFromPixel(const float2 &p) const
 {
   return p * m_frameData.invSize;
 }
 
-void Frame::writeSample(int x, int y, const PixelSample &s)
+void Frame::writeTile(const Tile &tile, const TileSamples &ts)
 {
-  const auto idx = y * m_frameData.size.x + x;
-  auto *color = m_pixelBuffer.data() + (idx * m_perPixelBytes);
+  const uint32_t width = tile.upper.x - tile.lower.x;
+
+  auto forEachRow = [&](auto &&f) {
+    for (uint32_t y = tile.lower.y; y < tile.upper.y; y++) {
+      const uint32_t src = (y - tile.lower.y) * width;
+      const uint32_t dst = y * m_frameData.size.x + tile.lower.x;
+      f(src, dst);
+    }
+  };
+
+  auto &fb = m_buffers[m_renderBuffer];
+  auto *pixels = fb.color.data();
   switch (m_colorType) {
-  case ANARI_UFIXED8_VEC4: {
-    auto c = helium::math::cvt_color_to_uint32(s.color);
-    std::memcpy(color, &c, sizeof(c));
+  case ANARI_UFIXED8_VEC4:
+    forEachRow([&](uint32_t src, uint32_t dst) {
+      convertRowUnorm8((uint32_t *)pixels + dst,
+          &ts.r[src],
+          &ts.g[src],
+          &ts.b[src],
+          &ts.a[src],
+          width);
+    });
     break;
-  }
-  case ANARI_UFIXED8_RGBA_SRGB: {
-    auto c = helium::math::cvt_color_to_uint32_srgb(s.color);
-    std::memcpy(color, &c, sizeof(c));
+  case ANARI_UFIXED8_RGBA_SRGB:
+    forEachRow([&](uint32_t src, uint32_t dst) {
+      convertRowSrgb8((uint32_t *)pixels + dst,
+          &ts.r[src],
+          &ts.g[src],
+          &ts.b[src],
+          &ts.a[src],
+          width);
+    });
     break;
-  }
-  case ANARI_FLOAT32_VEC4: {
-    std::memcpy(color, &s.color, sizeof(s.color));
+  case ANARI_FLOAT32_VEC4:
+    forEachRow([&](uint32_t src, uint32_t dst) {
+      convertRowFloat4((float *)pixels + 4 * dst,
+          &ts.r[src],
+          &ts.g[src],
+          &ts.b[src],
+          &ts.a[src],
+          width);
+    });
     break;
-  }
   default:
     break;
   }
-  if (!m_depthBuffer.empty())
-    m_depthBuffer[idx] = s.depth;
-  if (!m_primIdBuffer.empty())
-    m_primIdBuffer[idx] = s.primId;
-  if (!m_objIdBuffer.empty())
-    m_objIdBuffer[idx] = s.objId;
-  if (!m_instIdBuffer.empty())
-    m_instIdBuffer[idx] = s.instId;
+
+  auto copyChannel = [&](const auto &in, auto &out) {
+    if (out.empty())
+      return;
+    forEachRow([&](uint32_t src, uint32_t dst) {
+      std::copy(&in[src], &in[src] + width, &out[dst]);
+    });
+  };
+
+  copyChannel(ts.depth, fb.depth);
+  copyChannel(ts.primId, fb.primId);
+  copyChannel(ts.objId, fb.objId);
+  copyChannel(ts.instId, fb.instId);
+}
+
+void Frame::copyTile(const Tile &tile, const FrameBuffers &src)
+{
+  auto &dst = m_buffers[m_renderBuffer];
+  const uint32_t width = tile.upper.x - tile.lower.x;
+
+  auto copyChannel = [&](const auto &in, auto &out, uint32_t elementsPerPixel) {
+    if (out.empty() || in.size() != out.size())
+      return;
+    for (uint32_t y = tile.lower.y; y < tile.upper.y; y++) {
+      const size_t offset =
+          size_t(y * m_frameData.size.x + tile.lower.x) * elementsPerPixel;
+      const size_t count = width * elementsPerPixel;
+      std::copy(&in[offset], &in[offset] + count, &out[offset]);
+    }
+  };
+
+  copyChannel(src.color, dst.color, m_perPixelBytes);
+  copyChannel(src.depth, dst.depth, 1);
+  copyChannel(src.primId, dst.primId, 1);
+  copyChannel(src.objId, dst.objId, 1);
+  copyChannel(src.instId, dst.instId, 1);
+}
+
+void Frame::clearTile(const Tile &tile)
+{
+  auto &dst = m_buffers[m_renderBuffer];
+  const uint32_t width = tile.upper.x - tile.lower.x;
+
+  auto clearChannel = [&](auto &out, uint32_t elementsPerPixel, auto value) {
+    if (out.empty())
+      return;
+    for (uint32_t y = tile.lower.y; y < tile.upper.y; y++) {
+      const size_t offset =
+          size_t(y * m_frameData.size.x + tile.lower.x) * elementsPerPixel;
+      const size_t count = width * elementsPerPixel;
+      std::fill(&out[offset], &out[offset] + count, value);
+    }
+  };
+
+  clearChannel(dst.color, m_perPixelBytes, uint8_t(0));
+  clearChannel(dst.depth, 1, std::numeric_limits<float>::infinity());
+  clearChannel(dst.primId, 1, ~0u);
+  clearChannel(dst.objId, 1, ~0u);
+  clearChannel(dst.instId, 1, ~0u);
+}
+
+void Frame::resizeFrameBuffers(FrameBuffers &fb) const
+{
+  const auto numPixels = m_frameData.size.x * m_frameData.size.y;
+
+  fb.color.resize(numPixels * m_perPixelBytes);
+  fb.depth.resize(m_depthType == ANARI_FLOAT32 ? numPixels : 0);
+  fb.primId.resize(m_primIdType == ANARI_UINT32 ? numPixels : 0);
+  fb.objId.resize(m_objIdType == ANARI_UINT32 ? numPixels : 0);
+  fb.instId.resize(m_instIdType == ANARI_UINT32 ? numPixels : 0);
+}
+
+int Frame::nextRenderBuffer() const
+{
+  return m_completedBuffer < 0 ? 0 : (m_completedBuffer + 1) % NUM_FRAMEBUFFERS;
+}
+
+void Frame::TileSamples::resize(size_t n)
+{
+  r.resize(n);
+  g.resize(n);
+  b.resize(n);
+  a.resize(n);
+  depth.resize(n);
+  primId.resize(n);
+  objId.resize(n);
+  instId.resize(n);
 }
 
 } // namespace helide
@@ -9,7 +9,10 @@
 // helium
 #include "helium/BaseFrame.h"
 // std
+#include <array>
+#include <atomic>
 #include <future>
+#include <limits>
 #include <vector>
 
 namespace helide {
@@ -44,8 +47,43 @@ struct Frame : public helium::BaseFrame
   void wait() const;
 
  private:
+  struct Tile
+  {
+    uint2 lower;
+    uint2 upper;
+    float variance{std::numeric_limits<float>::infinity()};
+    uint32_t accumFrames{0};
+    bool stale{true}; // pixels do not show the current scene yet
+  };
+
+  struct FrameBuffers
+  {
+    std::vector<uint8_t> color;
+    std::vector<float> depth;
+    std::vector<uint32_t> primId;
+    std::vector<uint32_t> objId;
+    std::vector<uint32_t> instId;
+  };
+
+  struct TileSamples // SoA staging of one tile's resolved samples
+  {
+    std::vector<float> r, g, b, a;
+    std::vector<float> depth;
+    std::vector<uint32_t> primId;
+    std::vector<uint32_t> objId;
+    std::vector<uint32_t> instId;
+
+    void resize(size_t n);
+  };
+
+  void buildTiles();
+  void renderTile(Tile &tile);
   float2 screenFromPixel(const float2 &p) const;
-  void writeSample(int x, int y, const PixelSample &s);
+  void writeTile(const Tile &tile, const TileSamples &ts);
+  void copyTile(const Tile &tile, const FrameBuffers &src);
+  void clearTile(const Tile &tile);
+  void resizeFrameBuffers(FrameBuffers &fb) const;
+  int nextRenderBuffer() const;
 
   //// Data ////
 
@@ -65,11 +103,23 @@ struct Frame : public helium::BaseFrame
   anari::DataType m_objIdType{ANARI_UNKNOWN};
   anari::DataType m_instIdType{ANARI_UNKNOWN};
 
-  std::vector<uint8_t> m_pixelBuffer;
-  std::vector<float> m_depthBuffer;
-  std::vector<uint32_t> m_primIdBuffer;
-  std::vector<uint32_t> m_objIdBuffer;
-  std::vector<uint32_t> m_instIdBuffer;
+  // Front and back framebuffers: frames render into the one not holding the
+  // last completed frame, so a discarded frame keeps presenting the previous
+  // one and skipped tiles can be copied from it
+  static constexpr int NUM_FRAMEBUFFERS = 2;
+  std::array<FrameBuffers, NUM_FRAMEBUFFERS> m_buffers;
+  int m_renderBuffer{0};
+  int m_completedBuffer{-1};
+
+  bool m_accumulate{false};
+  std::vector<float4> m_accumBuffer;
+  std::vector<float> m_accumLumSqBuffer; // for variance estimation
+
+  float m_varianceThreshold{0.f};
+  float m_variance{std::numeric_limits<float>::infinity()};
+
+  uint32_t m_tileSize{16};
+  std::vector<Tile> m_tiles; // Morton ordered for cache locality
 
   helium::IntrusivePtr<Renderer> m_renderer;
   helium::IntrusivePtr<Camera> m_camera;
@@ -77,6 +127,31 @@ struct Frame : public helium::BaseFrame
 
   float m_duration{0.f};
 
+  struct Stats // per-stage breakdown of the last rendered frame
+  {
+    float commitFlush{0.f};
+    float blsRebuild{0.f};
+    float blsCommit{0.f};
+    float tlsRebuild{0.f};
+    float trace{0.f}; // trace, shade + write: thread time summed over workers
+    float shade{0.f};
+    float write{0.f};
+    uint64_t raysTraced{0};
+    uint64_t volumeSamples{0};
+  } m_stats;
+
+  struct TileCounters // accumulated by tile workers during a frame
+  {
+    std::atomic<uint64_t> traceNs{0};
+    std::atomic<uint64_t> shadeNs{0};
+    std::atomic<uint64_t> writeNs{0};
+    std::atomic<uint64_t> raysTraced{0};
+    std::atomic<uint64_t> volumeSamples{0};
+  } m_tileCounters;
+
+  float m_timeBudget{0.f};
+  std::atomic<bool> m_cancelRender{false};
+
   bool m_frameChanged{false};
   helium::TimeStamp m_cameraLastChanged{0};
   helium::TimeStamp m_rendererLastChanged{0};
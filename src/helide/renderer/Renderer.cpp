@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Renderer.h"
+// std
+#include <algorithm>
+#include <numeric>
 
 namespace helide {
 
@@ -43,6 +46,14 @@ static RenderMode renderModeFromString(const std::string &name)
     return RenderMode::DEFAULT;
 }
 
+static TraceMode traceModeFromString(const std::string &name)
+{
+  if (name == "stream")
+    return TraceMode::STREAM;
+  else
+    return TraceMode::SCALAR;
+}
+
 static float3 makeRandomColor(uint32_t i)
 {
   const uint32_t mx = 13 * 17 * 43;
@@ -68,6 +79,17 @@ static float3 readAttributeValue(Attribute a, const Ray &r, const World &w)
   return float3(v.x, v.y, v.z);
 }
 
+// Samplers pick mip levels against object-space triangle areas, so ray
+// footprints are scaled into the hit instance's space first
+static float objectSpaceFootprintScale(const Instance &inst)
+{
+  if (inst.xfmIsIdentity())
+    return 1.f;
+  const mat4 &m = inst.xfmInv();
+  const mat3 l(m[0].xyz(), m[1].xyz(), m[2].xyz());
+  return std::cbrt(std::abs(linalg::determinant(l)));
+}
+
 static float4 backgroundColorFromImage(
     const Array2D &image, const float2 &screen)
 {
@@ -108,18 +130,114 @@ void Renderer::commit()
   m_bgImage = getParamObject<Array2D>("background");
   m_ambientRadiance = getParam<float>("ambientRadiance", 1.f);
   m_mode = renderModeFromString(getParamString("mode", "default"));
+  m_traceMode = traceModeFromString(getParamString("traceMode", "scalar"));
+  m_pixelSamples = std::max(getParam<int>("pixelSamples", 1), 1);
 }
 
-PixelSample Renderer::renderSample(
-    const float2 &screen, Ray ray, const World &w) const
+void Renderer::intersectSurfaces(
+    Ray *rays, uint32_t numRays, const World &w) const
 {
-  PixelSample retval;
-
-  // Intersect Surfaces //
-
   RTCIntersectContext context;
   rtcInitIntersectContext(&context);
-  rtcIntersect1(w.embreeScene(), &context, (RTCRayHit *)&ray);
+
+  if (m_traceMode == TraceMode::STREAM) {
+    context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+    rtcIntersect1M(
+        w.embreeScene(), &context, (RTCRayHit *)rays, numRays, sizeof(Ray));
+  } else {
+    for (uint32_t i = 0; i < numRays; i++)
+      rtcIntersect1(w.embreeScene(), &context, (RTCRayHit *)&rays[i]);
+  }
+}
+
+void Renderer::shadeSamples(const float2 *screens,
+    const Ray *rays,
+    uint32_t numRays,
+    const World &w,
+    PixelSample *samples) const
+{
+  thread_local std::vector<float4> colors;
+  thread_local std::vector<float> opacities;
+
+  colors.assign(numRays, float4(0.f));
+  opacities.assign(numRays, 0.f);
+
+  if (m_mode == RenderMode::DEFAULT || m_mode == RenderMode::OPACITY_HEATMAP)
+    evaluateSurfaces(rays, numRays, w, colors.data(), opacities.data());
+
+  for (uint32_t i = 0; i < numRays; i++)
+    samples[i] = shadeSample(screens[i], rays[i], colors[i], opacities[i], w);
+}
+
+void Renderer::evaluateSurfaces(const Ray *rays,
+    uint32_t numRays,
+    const World &w,
+    float4 *colors,
+    float *opacities) const
+{
+  thread_local std::vector<uint32_t> order;
+  thread_local std::vector<Ray> groupRays;
+  thread_local std::vector<float4> groupColors;
+  thread_local std::vector<float> groupOpacities;
+
+  const auto surfaceKey = [&](uint32_t i) {
+    return (uint64_t(rays[i].instID) << 32) | rays[i].geomID;
+  };
+
+  order.resize(numRays);
+  std::iota(order.begin(), order.end(), 0u);
+  std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+    return surfaceKey(a) < surfaceKey(b);
+  });
+
+  // Each run of rays on one surface looks up its instance, surface and
+  // footprint scale once, and hands the whole run to the surface so the
+  // material's color source and the attribute interpolation are chosen once
+  uint32_t end = 0;
+  for (uint32_t begin = 0; begin < numRays; begin = end) {
+    const Ray &first = rays[order[begin]];
+    if (first.geomID == RTC_INVALID_GEOMETRY_ID)
+      break; // misses sort last
+
+    const auto key = surfaceKey(order[begin]);
+    for (end = begin + 1; end < numRays && surfaceKey(order[end]) == key;)
+      end++;
+    const uint32_t count = end - begin;
+
+    const Instance *inst = w.instanceFromRay(first);
+    const Surface *surface = w.surfaceFromRay(first);
+    const float scale = objectSpaceFootprintScale(*inst);
+
+    groupRays.resize(count);
+    for (uint32_t i = 0; i < count; i++) {
+      Ray &r = groupRays[i] = rays[order[begin + i]];
+      r.coneWidth *= scale;
+      r.coneSpread *= scale;
+    }
+
+    groupColors.resize(count);
+    surface->getSurfaceColors(groupRays.data(), count, groupColors.data());
+    for (uint32_t i = 0; i < count; i++)
+      colors[order[begin + i]] = groupColors[i];
+
+    if (m_mode == RenderMode::OPACITY_HEATMAP) {
+      groupOpacities.resize(count);
+      surface->getSurfaceOpacities(
+          groupRays.data(), count, groupOpacities.data());
+      for (uint32_t i = 0; i < count; i++)
+        opacities[order[begin + i]] = groupOpacities[i];
+    }
+  }
+}
+
+PixelSample Renderer::shadeSample(const float2 &screen,
+    const Ray &ray,
+    const float4 &surfaceColor,
+    float surfaceOpacity,
+    const World &w) const
+{
+  PixelSample retval;
+
   const bool hitGeometry = ray.geomID != RTC_INVALID_GEOMETRY_ID;
 
   // Intersect Volumes //
@@ -133,7 +251,13 @@ PixelSample Renderer::renderSample(
 
   // Shade //
 
-  retval.color = shadeRay(screen, ray, vray, w);
+  retval.color = shadeRay(screen,
+      ray,
+      vray,
+      surfaceColor,
+      surfaceOpacity,
+      w,
+      retval.volumeSamples);
   retval.depth = hitVolume ? std::min(ray.tfar, vray.t.lower) : ray.tfar;
   if (hitGeometry || hitVolume) {
     retval.primId = hitVolume ? 0 : ray.primID;
@@ -145,6 +269,11 @@ PixelSample Renderer::renderSample(
   return retval;
 }
 
+uint32_t Renderer::pixelSamples() const
+{
+  return m_pixelSamples;
+}
+
 Renderer *Renderer::createInstance(
     std::string_view /* subtype */, HelideGlobalState *s)
 {
@@ -154,7 +283,10 @@ Renderer *Renderer::createInstance(
 float4 Renderer::shadeRay(const float2 &screen,
     const Ray &ray,
     const VolumeRay &vray,
-    const World &w) const
+    const float4 &surfaceColor,
+    float surfaceOpacity,
+    const World &w,
+    uint32_t &volumeSamples) const
 {
   const bool hitGeometry = ray.geomID != RTC_INVALID_GEOMETRY_ID;
   const bool hitVolume = vray.volume != nullptr;
@@ -237,9 +369,9 @@ float4 Renderer::shadeRay(const float2 &screen,
       const auto n = linalg::mul(inst->xfmInvRot(), ray.Ng);
       const auto falloff =
           std::abs(linalg::dot(-ray.dir, linalg::normalize(n)));
-      const float4 sc = surface->getSurfaceColor(ray);
-      const float so = surface->getSurfaceOpacity(ray);
-      const float o = surface->adjustedAlpha(std::clamp(sc.w * so, 0.f, 1.f));
+      const float4 &sc = surfaceColor;
+      const float o = surface->adjustedAlpha(
+          std::clamp(sc.w * surfaceOpacity, 0.f, 1.f));
       const float3 c = m_heatmap->valueAtLinear<float3>(o);
       const float3 fc = c * falloff;
       geometryColor =
@@ -250,12 +382,11 @@ float4 Renderer::shadeRay(const float2 &screen,
   default: {
     if (hitGeometry) {
       const Instance *inst = w.instanceFromRay(ray);
-      const Surface *surface = w.surfaceFromRay(ray);
 
       const auto n = linalg::mul(inst->xfmInvRot(), ray.Ng);
       const auto falloff =
           std::abs(linalg::dot(-ray.dir, linalg::normalize(n)));
-      const float4 c = surface->getSurfaceColor(ray);
+      const float4 &c = surfaceColor;
       const float3 sc = float3(c.x, c.y, c.z) * falloff;
       volumeColor = geometryColor = linalg::min(
           (0.8f * sc + 0.2f * float3(c.x, c.y, c.z)) * m_ambientRadiance,
@@ -263,7 +394,7 @@ float4 Renderer::shadeRay(const float2 &screen,
     }
 
     if (hitVolume)
-      vray.volume->render(vray, volumeColor, volumeOpacity);
+      volumeSamples = vray.volume->render(vray, volumeColor, volumeOpacity);
 
   } break;
   }
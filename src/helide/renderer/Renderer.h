@@ -17,6 +17,7 @@ struct PixelSample
   uint32_t primId{~0u};
   uint32_t objId{~0u};
   uint32_t instId{~0u};
+  uint32_t volumeSamples{0};
 };
 
 enum class RenderMode
@@ -42,6 +43,12 @@ enum class RenderMode
   OPACITY_HEATMAP
 };
 
+enum class TraceMode
+{
+  SCALAR,
+  STREAM
+};
+
 struct Renderer : public Object
 {
   Renderer(HelideGlobalState *s);
@@ -49,20 +56,46 @@ struct Renderer : public Object
 
   virtual void commit() override;
 
-  PixelSample renderSample(const float2 &screen, Ray ray, const World &w) const;
+  // Tiles are traced as a batch of rays, then shaded as a batch grouped by
+  // the surface each ray hit
+  void intersectSurfaces(Ray *rays, uint32_t numRays, const World &w) const;
+  void shadeSamples(const float2 *screens,
+      const Ray *rays,
+      uint32_t numRays,
+      const World &w,
+      PixelSample *samples) const;
+
+  uint32_t pixelSamples() const;
 
   static Renderer *createInstance(
       std::string_view subtype, HelideGlobalState *d);
 
  private:
+  // Surface colors (and opacities for the opacity heatmap) of all rays that
+  // hit the same surface, evaluated together before the per-sample shading
+  void evaluateSurfaces(const Ray *rays,
+      uint32_t numRays,
+      const World &w,
+      float4 *colors,
+      float *opacities) const;
+  PixelSample shadeSample(const float2 &screen,
+      const Ray &ray,
+      const float4 &surfaceColor,
+      float surfaceOpacity,
+      const World &w) const;
   float4 shadeRay(const float2 &screen,
       const Ray &ray,
       const VolumeRay &vray,
-      const World &w) const;
+      const float4 &surfaceColor,
+      float surfaceOpacity,
+      const World &w,
+      uint32_t &volumeSamples) const;
 
   float4 m_bgColor{float3(0.f), 1.f};
   float m_ambientRadiance{1.f};
   RenderMode m_mode{RenderMode::DEFAULT};
+  TraceMode m_traceMode{TraceMode::SCALAR};
+  uint32_t m_pixelSamples{1};
 
   helium::IntrusivePtr<Array1D> m_heatmap;
   helium::IntrusivePtr<Array2D> m_bgImage;
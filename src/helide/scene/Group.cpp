@@ -3,7 +3,10 @@
 
 #include "Group.h"
 // std
+#include <algorithm>
+#include <chrono>
 #include <iterator>
+#include <limits>
 
 namespace helide {
 
@@ -22,7 +25,9 @@ bool Group::getProperty(
   if (name == "bounds" && type == ANARI_FLOAT32_BOX3) {
     if (flags & ANARI_WAIT) {
       embreeSceneConstruct();
+      updateChangeObservers();
       embreeSceneCommit();
+      reportQueuedMessages();
     }
     auto bounds = getEmbreeSceneBounds(m_embreeScene);
     for (auto *v : volumes()) {
@@ -31,6 +36,15 @@ bool Group::getProperty(
     }
     std::memcpy(ptr, &bounds, sizeof(bounds));
     return true;
+  } else if (name == "bvh.buildQuality" && type == ANARI_STRING) {
+    helium::writeToVoidP(ptr, buildQualityToString(m_bvhSettings.quality));
+    return true;
+  } else if (name == "bvh.sceneFlags" && type == ANARI_UINT32) {
+    helium::writeToVoidP(ptr, uint32_t(m_bvhSettings.flags));
+    return true;
+  } else if (name == "bvh.buildTime" && type == ANARI_FLOAT32) {
+    helium::writeToVoidP(ptr, m_lastBuildTime);
+    return true;
   }
 
   return Object::getProperty(name, type, ptr, flags);
@@ -42,6 +56,8 @@ void Group::commit()
 
   m_surfaceData = getParamObject<ObjectArray>("surface");
   m_volumeData = getParamObject<ObjectArray>("volume");
+  m_bvhSettings =
+      bvhSettingsFromParams(*this, deviceState()->groupBVHDefaults);
 
   if (m_volumeData) {
     std::transform(m_volumeData->handlesBegin(),
@@ -61,56 +77,62 @@ const std::vector<Volume *> &Group::volumes() const
   return m_volumes;
 }
 
-void Group::intersectVolumes(VolumeRay &ray) const
-{
-  Volume *originalVolume = ray.volume;
-  box1 t = ray.t;
-
-  for (auto *v : volumes()) {
-    if (!v->isValid())
-      continue;
-    const box3 bounds = v->bounds();
-    const float3 mins = (bounds.lower - ray.org) * (1.f / ray.dir);
-    const float3 maxs = (bounds.upper - ray.org) * (1.f / ray.dir);
-    const float3 nears = linalg::min(mins, maxs);
-    const float3 fars = linalg::max(mins, maxs);
-
-    const box1 lt(linalg::maxelem(nears), linalg::minelem(fars));
-
-    if (lt.lower < lt.upper && (!ray.volume || lt.lower < t.lower)) {
-      t.lower = clamp(lt.lower, t);
-      t.upper = clamp(lt.upper, t);
-      ray.volume = v;
-    }
-  }
-
-  if (ray.volume != originalVolume)
-    ray.t = t;
-}
-
 void Group::markCommitted()
 {
   Object::markCommitted();
+  markBLSReconstructRequested();
   deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
       helium::newTimeStamp();
 }
 
+void Group::markBLSReconstructRequested()
+{
+  m_objectUpdates.lastReconstructRequest = helium::newTimeStamp();
+}
+
+void Group::markBLSCommitRequested()
+{
+  m_objectUpdates.lastCommitRequest = helium::newTimeStamp();
+}
+
 RTCScene Group::embreeScene() const
 {
   return m_embreeScene;
 }
 
+RTCScene Group::embreeVolumeScene() const
+{
+  return m_embreeVolumeScene;
+}
+
+helium::TimeStamp Group::embreeSceneLastChanged() const
+{
+  return std::max(m_objectUpdates.lastSceneConstruction,
+      m_objectUpdates.lastSceneCommit);
+}
+
+template <typename... Args>
+void Group::queueDebugMessage(const char *fmt, Args &&...args)
+{
+  m_queuedMessages.push_back(
+      helium::string_printf(fmt, std::forward<Args>(args)...));
+}
+
 void Group::embreeSceneConstruct()
 {
   const auto &state = *deviceState();
-  if (m_objectUpdates.lastSceneConstruction
-      > state.objectUpdates.lastBLSReconstructSceneRequest)
+  const auto lastRequest =
+      std::max(m_objectUpdates.lastReconstructRequest.load(),
+          state.objectUpdates.lastBLSReconstructAllRequest);
+  if (m_objectUpdates.lastSceneConstruction > lastRequest)
     return;
 
-  reportMessage(ANARI_SEVERITY_DEBUG, "helide::Group rebuilding embree scene");
+  queueDebugMessage("helide::Group rebuilding embree scene");
 
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = rtcNewScene(deviceState()->embreeDevice);
+  applyBVHSettings(m_embreeScene, m_bvhSettings);
+  m_surfaces.clear();
 
   if (m_surfaceData) {
     uint32_t id = 0;
@@ -123,52 +145,194 @@ void Group::embreeSceneConstruct()
             rtcAttachGeometryByID(
                 m_embreeScene, s->geometry()->embreeGeometry(), id++);
           } else {
-            reportMessage(ANARI_SEVERITY_DEBUG,
+            queueDebugMessage(
                 "helide::Group rejecting invalid surface(%p) in building BLS",
                 s);
             auto *g = s->geometry();
-            if (!g || !g->isValid()) {
-              reportMessage(
-                  ANARI_SEVERITY_DEBUG, "    helide::Geometry is invalid");
-            }
+            if (!g || !g->isValid())
+              queueDebugMessage("    helide::Geometry is invalid");
             auto *m = s->material();
-            if (!m || !m->isValid()) {
-              reportMessage(
-                  ANARI_SEVERITY_DEBUG, "    helide::Material is invalid");
-            }
+            if (!m || !m->isValid())
+              queueDebugMessage("    helide::Material is invalid");
           }
         });
   }
 
+  rtcReleaseScene(m_embreeVolumeScene);
+  m_embreeVolumeScene = nullptr;
+
+  if (!m_volumes.empty()) {
+    m_embreeVolumeScene = rtcNewScene(deviceState()->embreeDevice);
+    applyBVHSettings(m_embreeVolumeScene, m_bvhSettings);
+
+    auto geom =
+        rtcNewGeometry(deviceState()->embreeDevice, RTC_GEOMETRY_TYPE_USER);
+    rtcSetGeometryUserPrimitiveCount(geom, uint32_t(m_volumes.size()));
+    rtcSetGeometryUserData(geom, this);
+    rtcSetGeometryBoundsFunction(geom, embreeVolumeBounds, nullptr);
+    rtcSetGeometryIntersectFunction(geom, embreeVolumeIntersect);
+    rtcCommitGeometry(geom);
+    rtcAttachGeometry(m_embreeVolumeScene, geom);
+    rtcReleaseGeometry(geom);
+  }
+
+  m_objectsToObserveChanged = true;
   m_objectUpdates.lastSceneConstruction = helium::newTimeStamp();
   m_objectUpdates.lastSceneCommit = 0;
   embreeSceneCommit();
 }
 
+std::vector<Geometry *> Group::referencedGeometries() const
+{
+  std::vector<Geometry *> geometries;
+  if (m_surfaceData) {
+    std::for_each(m_surfaceData->handlesBegin(),
+        m_surfaceData->handlesEnd(),
+        [&](auto *o) {
+          auto *s = (Surface *)o;
+          if (s && s->geometry())
+            geometries.push_back(s->geometry());
+        });
+  }
+  return geometries;
+}
+
+void Group::updateChangeObservers()
+{
+  if (!m_objectsToObserveChanged)
+    return;
+
+  // Rejected surfaces are observed too, so that fixing one (or its geometry)
+  // brings it into the BLS
+  m_observedSurfaces.clear();
+  m_observedGeometries.clear();
+  if (m_surfaceData) {
+    std::for_each(m_surfaceData->handlesBegin(),
+        m_surfaceData->handlesEnd(),
+        [&](auto *o) {
+          auto *s = (Surface *)o;
+          if (!s)
+            return;
+          m_observedSurfaces.emplace_back(this, s);
+          if (auto *g = s->geometry())
+            m_observedGeometries.emplace_back(this, g);
+        });
+  }
+
+  m_observedVolumes.clear();
+  for (auto *v : m_volumes) {
+    if (v)
+      m_observedVolumes.emplace_back(this, v);
+  }
+
+  m_objectsToObserveChanged = false;
+}
+
 void Group::embreeSceneCommit()
 {
-  const auto &state = *deviceState();
   if (!m_embreeScene
       || m_objectUpdates.lastSceneCommit
-          > state.objectUpdates.lastBLSCommitSceneRequest)
+          > m_objectUpdates.lastCommitRequest.load())
     return;
 
-  reportMessage(ANARI_SEVERITY_DEBUG, "helide::Group committing embree scene");
+  queueDebugMessage("helide::Group committing embree scene");
 
+  const auto start = std::chrono::steady_clock::now();
   rtcCommitScene(m_embreeScene);
+  if (m_embreeVolumeScene) {
+    // volume bounds are only re-queried from geometries marked as modified
+    rtcCommitGeometry(rtcGetGeometry(m_embreeVolumeScene, 0));
+    rtcCommitScene(m_embreeVolumeScene);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  m_lastBuildTime = std::chrono::duration<float>(end - start).count();
   m_objectUpdates.lastSceneCommit = helium::newTimeStamp();
 }
 
+void Group::reportQueuedMessages()
+{
+  for (const auto &msg : m_queuedMessages)
+    reportMessage(ANARI_SEVERITY_DEBUG, "%s", msg.c_str());
+  m_queuedMessages.clear();
+}
+
 void Group::cleanup()
 {
   m_surfaces.clear();
   m_volumes.clear();
+  m_observedSurfaces.clear();
+  m_observedGeometries.clear();
+  m_observedVolumes.clear();
+  m_objectsToObserveChanged = false;
 
   m_objectUpdates.lastSceneConstruction = 0;
   m_objectUpdates.lastSceneCommit = 0;
 
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = nullptr;
+  rtcReleaseScene(m_embreeVolumeScene);
+  m_embreeVolumeScene = nullptr;
+}
+
+void Group::embreeVolumeBounds(const RTCBoundsFunctionArguments *args)
+{
+  const auto *g = (const Group *)args->geometryUserPtr;
+  const auto *v = g->volumes()[args->primID];
+
+  // inverted bounds make embree skip the primitive until the volume is valid
+  box3 b(float3(std::numeric_limits<float>::max()),
+      float3(-std::numeric_limits<float>::max()));
+  if (v && v->isValid())
+    b = v->bounds();
+
+  auto *out = args->bounds_o;
+  out->lower_x = b.lower.x;
+  out->lower_y = b.lower.y;
+  out->lower_z = b.lower.z;
+  out->upper_x = b.upper.x;
+  out->upper_y = b.upper.y;
+  out->upper_z = b.upper.z;
+}
+
+void Group::embreeVolumeIntersect(const RTCIntersectFunctionNArguments *args)
+{
+  const auto *g = (const Group *)args->geometryUserPtr;
+  const auto *v = g->volumes()[args->primID];
+  if (!v || !v->isValid())
+    return;
+
+  const box3 bounds = v->bounds();
+  const auto N = args->N;
+  auto *rays = RTCRayHitN_RayN(args->rayhit, N);
+  auto *hits = RTCRayHitN_HitN(args->rayhit, N);
+
+  for (unsigned int i = 0; i < N; i++) {
+    if (args->valid[i] != -1)
+      continue;
+
+    const float3 org(RTCRayN_org_x(rays, N, i),
+        RTCRayN_org_y(rays, N, i),
+        RTCRayN_org_z(rays, N, i));
+    const float3 dir(RTCRayN_dir_x(rays, N, i),
+        RTCRayN_dir_y(rays, N, i),
+        RTCRayN_dir_z(rays, N, i));
+    const box1 t = intersectBox(bounds, org, dir);
+
+    // report the entry point, clamped to the ray origin when starting inside
+    const float entry = std::max(t.lower, RTCRayN_tnear(rays, N, i));
+    float &tfar = RTCRayN_tfar(rays, N, i);
+    if (entry < t.upper && entry < tfar) {
+      tfar = entry;
+      RTCHitN_Ng_x(hits, N, i) = 0.f;
+      RTCHitN_Ng_y(hits, N, i) = 0.f;
+      RTCHitN_Ng_z(hits, N, i) = 0.f;
+      RTCHitN_u(hits, N, i) = 0.f;
+      RTCHitN_v(hits, N, i) = 0.f;
+      RTCHitN_primID(hits, N, i) = args->primID;
+      RTCHitN_geomID(hits, N, i) = args->geomID;
+      RTCHitN_instID(hits, N, i, 0) = args->context->instID[0];
+    }
+  }
 }
 
 box3 getEmbreeSceneBounds(RTCScene scene)
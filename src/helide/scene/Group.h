@@ -7,6 +7,9 @@
 #include "light/Light.h"
 #include "surface/Surface.h"
 #include "volume/Volume.h"
+// std
+#include <atomic>
+#include <string>
 
 namespace helide {
 
@@ -25,17 +28,39 @@ struct Group : public Object
   const std::vector<Surface *> &surfaces() const;
   const std::vector<Volume *> &volumes() const;
 
-  void intersectVolumes(VolumeRay &ray) const;
-
   void markCommitted() override;
 
+  // Called when an observed surface, geometry or volume in this group changes
+  void markBLSReconstructRequested();
+  void markBLSCommitRequested();
+
   RTCScene embreeScene() const;
+  RTCScene embreeVolumeScene() const; // nullptr if there are no volumes
+  helium::TimeStamp embreeSceneLastChanged() const;
   void embreeSceneConstruct();
   void embreeSceneCommit();
 
+  // Geometries of all surfaces in 'm_surfaceData', valid or not
+  std::vector<Geometry *> referencedGeometries() const;
+
+  // Re-registers this group with the surfaces and geometries it references.
+  // helium's observer lists are not thread-safe, so unlike
+  // embreeSceneConstruct() this must not run concurrently with other groups.
+  void updateChangeObservers();
+
+  // embreeSceneConstruct() and embreeSceneCommit() may run on Embree worker
+  // threads, so they queue their messages for the caller to report here
+  void reportQueuedMessages();
+
  private:
   void cleanup();
 
+  template <typename... Args>
+  void queueDebugMessage(const char *fmt, Args &&...args);
+
+  static void embreeVolumeBounds(const RTCBoundsFunctionArguments *args);
+  static void embreeVolumeIntersect(const RTCIntersectFunctionNArguments *args);
+
   // Geometry //
 
   helium::ChangeObserverPtr<ObjectArray> m_surfaceData;
@@ -52,9 +77,24 @@ struct Group : public Object
   {
     helium::TimeStamp lastSceneConstruction{0};
     helium::TimeStamp lastSceneCommit{0};
+    std::atomic<helium::TimeStamp> lastReconstructRequest{0};
+    std::atomic<helium::TimeStamp> lastCommitRequest{0};
   } m_objectUpdates;
 
+  // Objects which notify this group (instead of re-committing it): every
+  // surface in 'm_surfaceData' and its geometry, whether in the BLS or not
+  std::vector<helium::ChangeObserverPtr<Surface>> m_observedSurfaces;
+  std::vector<helium::ChangeObserverPtr<Geometry>> m_observedGeometries;
+  std::vector<helium::ChangeObserverPtr<Volume>> m_observedVolumes;
+  bool m_objectsToObserveChanged{false};
+
+  std::vector<std::string> m_queuedMessages;
+
+  BVHSettings m_bvhSettings;
+  float m_lastBuildTime{0.f};
+
   RTCScene m_embreeScene{nullptr};
+  RTCScene m_embreeVolumeScene{nullptr}; // one user geometry over m_volumes
 };
 
 box3 getEmbreeSceneBounds(RTCScene scene);
@@ -9,17 +9,21 @@ Instance::Instance(HelideGlobalState *s) : Object(ANARI_INSTANCE, s)
 {
   m_embreeGeometry =
       rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_INSTANCE);
+  m_embreeVolumeGeometry =
+      rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_INSTANCE);
 }
 
 Instance::~Instance()
 {
   rtcReleaseGeometry(m_embreeGeometry);
+  rtcReleaseGeometry(m_embreeVolumeGeometry);
 }
 
 void Instance::commit()
 {
   m_id = getParam<uint32_t>("id", ~0u);
   m_xfm = getParam<mat4>("transform", mat4(linalg::identity));
+  m_xfmInv = linalg::inverse(m_xfm);
   m_xfmInvRot = linalg::inverse(extractRotation(m_xfm));
   m_group = getParamObject<Group>("group");
   if (!m_group)
@@ -36,6 +40,11 @@ const mat4 &Instance::xfm() const
   return m_xfm;
 }
 
+const mat4 &Instance::xfmInv() const
+{
+  return m_xfmInv;
+}
+
 const mat3 &Instance::xfmInvRot() const
 {
   return m_xfmInvRot;
@@ -61,12 +70,32 @@ RTCGeometry Instance::embreeGeometry() const
   return m_embreeGeometry;
 }
 
-void Instance::embreeGeometryUpdate()
+RTCGeometry Instance::embreeVolumeGeometry() const
+{
+  return m_embreeVolumeGeometry;
+}
+
+bool Instance::embreeGeometryNeedsUpdate() const
+{
+  return lastCommitted() > m_lastEmbreeGeometryUpdate
+      || group()->embreeSceneLastChanged() > m_lastEmbreeGeometryUpdate;
+}
+
+void Instance::embreeGeometryUpdate(RTCBuildQuality quality)
 {
   rtcSetGeometryInstancedScene(m_embreeGeometry, group()->embreeScene());
   rtcSetGeometryTransform(
       m_embreeGeometry, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR, &m_xfm);
+  rtcSetGeometryBuildQuality(m_embreeGeometry, quality);
   rtcCommitGeometry(m_embreeGeometry);
+  if (auto *volumeScene = group()->embreeVolumeScene()) {
+    rtcSetGeometryInstancedScene(m_embreeVolumeGeometry, volumeScene);
+    rtcSetGeometryTransform(
+        m_embreeVolumeGeometry, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR, &m_xfm);
+    rtcSetGeometryBuildQuality(m_embreeVolumeGeometry, quality);
+    rtcCommitGeometry(m_embreeVolumeGeometry);
+  }
+  m_lastEmbreeGeometryUpdate = helium::newTimeStamp();
 }
 
 void Instance::markCommitted()
@@ -17,6 +17,7 @@ struct Instance : public Object
   uint32_t id() const;
 
   const mat4 &xfm() const;
+  const mat4 &xfmInv() const;
   const mat3 &xfmInvRot() const;
   bool xfmIsIdentity() const;
 
@@ -24,7 +25,10 @@ struct Instance : public Object
   Group *group();
 
   RTCGeometry embreeGeometry() const;
-  void embreeGeometryUpdate();
+  RTCGeometry embreeVolumeGeometry() const;
+  bool embreeGeometryNeedsUpdate() const;
+  // 'quality' is RTC_BUILD_QUALITY_REFIT when only the transform or BLS moved
+  void embreeGeometryUpdate(RTCBuildQuality quality);
 
   void markCommitted() override;
 
@@ -33,9 +37,12 @@ struct Instance : public Object
  private:
   uint32_t m_id{~0u};
   mat4 m_xfm;
+  mat4 m_xfmInv;
   mat3 m_xfmInvRot;
   helium::IntrusivePtr<Group> m_group;
   RTCGeometry m_embreeGeometry{nullptr};
+  RTCGeometry m_embreeVolumeGeometry{nullptr};
+  helium::TimeStamp m_lastEmbreeGeometryUpdate{0};
 };
 
 } // namespace helide
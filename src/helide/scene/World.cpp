@@ -2,6 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "World.h"
+// std
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <unordered_set>
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
@@ -32,14 +39,19 @@ bool World::getProperty(
     if (flags & ANARI_WAIT)
       embreeSceneUpdate();
     auto bounds = getEmbreeSceneBounds(m_embreeScene);
-    for (auto *i : instances()) {
-      for (auto *v : i->group()->volumes()) {
-        if (v->isValid())
-          bounds.extend(v->bounds());
-      }
-    }
+    if (m_embreeVolumeScene)
+      bounds.extend(getEmbreeSceneBounds(m_embreeVolumeScene));
     std::memcpy(ptr, &bounds, sizeof(bounds));
     return true;
+  } else if (name == "bvh.buildQuality" && type == ANARI_STRING) {
+    helium::writeToVoidP(ptr, buildQualityToString(m_bvhSettings.quality));
+    return true;
+  } else if (name == "bvh.sceneFlags" && type == ANARI_UINT32) {
+    helium::writeToVoidP(ptr, uint32_t(m_bvhSettings.flags));
+    return true;
+  } else if (name == "bvh.buildTime" && type == ANARI_FLOAT32) {
+    helium::writeToVoidP(ptr, m_lastBuildTime);
+    return true;
   }
 
   return Object::getProperty(name, type, ptr, flags);
@@ -52,6 +64,13 @@ void World::commit()
   m_zeroSurfaceData = getParamObject<ObjectArray>("surface");
   m_zeroVolumeData = getParamObject<ObjectArray>("volume");
 
+  // moved instances are refit, so the TLS is only built when instances are
+  // added or removed; the dynamic flag keeps per instance refits possible
+  BVHSettings tlsDefaults;
+  tlsDefaults.quality = RTC_BUILD_QUALITY_MEDIUM;
+  tlsDefaults.flags = RTC_SCENE_FLAG_DYNAMIC;
+  m_bvhSettings = bvhSettingsFromParams(*this, tlsDefaults);
+
   const bool addZeroInstance = m_zeroSurfaceData || m_zeroVolumeData;
   if (addZeroInstance)
     reportMessage(ANARI_SEVERITY_DEBUG, "helide::World will add zero instance");
@@ -94,6 +113,7 @@ void World::commit()
     m_instances.push_back(m_zeroInstance.ptr);
 
   m_objectUpdates.lastTLSBuild = 0;
+  m_objectUpdates.lastTLSCommit = 0;
   m_objectUpdates.lastBLSReconstructCheck = 0;
   m_objectUpdates.lastBLSCommitCheck = 0;
 }
@@ -105,13 +125,36 @@ const std::vector<Instance *> &World::instances() const
 
 void World::intersectVolumes(VolumeRay &ray) const
 {
-  const auto &insts = instances();
-  for (uint32_t i = 0; i < insts.size(); i++) {
-    const auto *inst = insts[i];
-    inst->group()->intersectVolumes(ray);
-    if (ray.volume)
-      ray.instID = i;
-  }
+  if (!m_embreeVolumeScene)
+    return;
+
+  Ray r;
+  r.org = ray.org;
+  r.dir = ray.dir;
+  r.tnear = ray.t.lower;
+  r.tfar = ray.t.upper;
+
+  RTCIntersectContext context;
+  rtcInitIntersectContext(&context);
+  rtcIntersect1(m_embreeVolumeScene, &context, (RTCRayHit *)&r);
+
+  if (r.geomID == RTC_INVALID_GEOMETRY_ID)
+    return;
+
+  // Volumes are sampled in object space, so move the ray there too (the
+  // parametric distances are unchanged by the affine instance transform)
+  const auto *inst = instances()[r.instID];
+  auto *v = inst->group()->volumes()[r.primID];
+  const float3 org = linalg::mul(inst->xfmInv(), float4(ray.org, 1.f)).xyz();
+  const float3 dir = linalg::mul(inst->xfmInv(), float4(ray.dir, 0.f)).xyz();
+  const box1 t = intersectBox(v->bounds(), org, dir);
+
+  ray.org = org;
+  ray.dir = dir;
+  ray.t.lower = r.tfar;
+  ray.t.upper = std::min(t.upper, ray.t.upper);
+  ray.volume = v;
+  ray.instID = r.instID;
 }
 
 RTCScene World::embreeScene() const
@@ -121,9 +164,53 @@ RTCScene World::embreeScene() const
 
 void World::embreeSceneUpdate()
 {
-  rebuildBLSs();
-  recommitBLSs();
-  rebuildTLS();
+  auto timeStage = [](auto &&f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<float>(end - start).count();
+  };
+
+  m_updateTimes.blsRebuild = timeStage([&]() { rebuildBLSs(); });
+  m_updateTimes.blsCommit = timeStage([&]() { recommitBLSs(); });
+  m_updateTimes.tlsRebuild = timeStage([&]() { rebuildTLS(); });
+}
+
+const World::UpdateTimes &World::lastUpdateTimes() const
+{
+  return m_updateTimes;
+}
+
+// Groups sharing a geometry attach and commit the same RTCGeometry, which
+// Embree does not document as safe from concurrent threads, so they are
+// processed serially once the other groups were processed in parallel
+template <typename FCN>
+static void forEachGroup(const std::vector<Group *> &groups, FCN &&f)
+{
+  std::unordered_map<const Geometry *, uint32_t> numGroupsUsing;
+  std::vector<std::vector<Geometry *>> geometries(groups.size());
+  for (size_t i = 0; i < groups.size(); i++) {
+    auto &geoms = geometries[i];
+    geoms = groups[i]->referencedGeometries();
+    std::sort(geoms.begin(), geoms.end());
+    geoms.erase(std::unique(geoms.begin(), geoms.end()), geoms.end());
+    for (auto *g : geoms)
+      numGroupsUsing[g]++;
+  }
+
+  std::vector<Group *> independent;
+  std::vector<Group *> sharing;
+  for (size_t i = 0; i < groups.size(); i++) {
+    const bool shares = std::any_of(geometries[i].begin(),
+        geometries[i].end(),
+        [&](const Geometry *g) { return numGroupsUsing[g] > 1; });
+    (shares ? sharing : independent).push_back(groups[i]);
+  }
+
+  embree::parallel_for(
+      independent.size(), [&](size_t i) { f(independent[i]); });
+  for (auto *g : sharing)
+    f(g);
 }
 
 void World::rebuildBLSs()
@@ -134,13 +221,16 @@ void World::rebuildBLSs()
     return;
   }
 
-  m_objectUpdates.lastTLSBuild = 0; // BLS changed, so need to build TLS
+  m_objectUpdates.lastTLSCommit = 0; // BLS changed, so need to update TLS
+  const auto groups = uniqueGroups();
   reportMessage(ANARI_SEVERITY_DEBUG,
       "helide::World rebuilding %zu BLSs",
-      m_instances.size());
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    inst->group()->embreeSceneConstruct();
-  });
+      groups.size());
+  forEachGroup(groups, [](Group *g) { g->embreeSceneConstruct(); });
+  for (auto *g : groups) {
+    g->updateChangeObservers();
+    g->reportQueuedMessages();
+  }
 
   m_objectUpdates.lastBLSReconstructCheck = helium::newTimeStamp();
   m_objectUpdates.lastBLSCommitCheck = helium::newTimeStamp();
@@ -154,22 +244,38 @@ void World::recommitBLSs()
     return;
   }
 
-  m_objectUpdates.lastTLSBuild = 0; // BLS changed, so need to build TLS
+  m_objectUpdates.lastTLSCommit = 0; // BLS changed, so need to update TLS
+  const auto groups = uniqueGroups();
   reportMessage(ANARI_SEVERITY_DEBUG,
       "helide::World recommitting %zu BLSs",
-      m_instances.size());
-  std::for_each(m_instances.begin(), m_instances.end(), [&](auto *inst) {
-    inst->group()->embreeSceneCommit();
-  });
+      groups.size());
+  forEachGroup(groups, [](Group *g) { g->embreeSceneCommit(); });
+  for (auto *g : groups)
+    g->reportQueuedMessages();
 
   m_objectUpdates.lastBLSCommitCheck = helium::newTimeStamp();
 }
 
+static bool instanceCanBeAttached(const Instance *i)
+{
+  return i && i->isValid() && !i->group()->surfaces().empty();
+}
+
+static bool instanceVolumesCanBeAttached(const Instance *i)
+{
+  return i && i->isValid() && i->group()->embreeVolumeScene();
+}
+
 void World::rebuildTLS()
 {
   const auto &state = *deviceState();
-  if (state.objectUpdates.lastTLSReconstructSceneRequest
-      < m_objectUpdates.lastTLSBuild) {
+  if (m_embreeScene && m_objectUpdates.lastTLSBuild != 0
+      && !tlsInstancesChanged()) {
+    if (m_objectUpdates.lastTLSCommit == 0
+        || state.objectUpdates.lastTLSReconstructSceneRequest
+            >= m_objectUpdates.lastTLSCommit) {
+      refitTLS();
+    }
     return;
   }
 
@@ -179,12 +285,29 @@ void World::rebuildTLS()
 
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = rtcNewScene(deviceState()->embreeDevice);
+  applyBVHSettings(m_embreeScene, m_bvhSettings);
+  rtcReleaseScene(m_embreeVolumeScene);
+  m_embreeVolumeScene = rtcNewScene(deviceState()->embreeDevice);
+  applyBVHSettings(m_embreeVolumeScene, m_bvhSettings);
+
+  m_instanceAttached.assign(m_instances.size(), false);
+  m_instanceVolumesAttached.assign(m_instances.size(), false);
 
   uint32_t id = 0;
   std::for_each(m_instances.begin(), m_instances.end(), [&](auto *i) {
-    if (i && i->isValid() && !i->group()->surfaces().empty()) {
-      i->embreeGeometryUpdate();
+    const bool attachVolumes = instanceVolumesCanBeAttached(i);
+    const bool attachSurfaces = instanceCanBeAttached(i);
+    // updates both the surface and volume geometries of the instance
+    if (attachVolumes || attachSurfaces)
+      i->embreeGeometryUpdate(m_bvhSettings.quality);
+    if (attachVolumes) {
+      rtcAttachGeometryByID(
+          m_embreeVolumeScene, i->embreeVolumeGeometry(), id);
+      m_instanceVolumesAttached[id] = true;
+    }
+    if (attachSurfaces) {
       rtcAttachGeometryByID(m_embreeScene, i->embreeGeometry(), id);
+      m_instanceAttached[id] = true;
     } else {
       if (i->group()->surfaces().empty()) {
         reportMessage(ANARI_SEVERITY_DEBUG,
@@ -201,14 +324,77 @@ void World::rebuildTLS()
     id++;
   });
 
+  commitTLS();
+  m_objectUpdates.lastTLSBuild = m_objectUpdates.lastTLSCommit;
+}
+
+bool World::tlsInstancesChanged() const
+{
+  // groups which gained or lost all surfaces/volumes add or remove instances
+  for (uint32_t id = 0; id < m_instances.size(); id++) {
+    auto *i = m_instances[id];
+    if (instanceCanBeAttached(i) != m_instanceAttached[id]
+        || instanceVolumesCanBeAttached(i) != m_instanceVolumesAttached[id])
+      return true;
+  }
+  return false;
+}
+
+void World::refitTLS()
+{
+  // Update only the instances which moved or whose BLS changed //
+
+  // an instance listed twice must only be updated by one worker
+  std::vector<Instance *> changed;
+  std::unordered_set<Instance *> visited;
+  for (uint32_t id = 0; id < m_instances.size(); id++) {
+    auto *i = m_instances[id];
+    const bool attached =
+        m_instanceAttached[id] || m_instanceVolumesAttached[id];
+    if (attached && visited.insert(i).second && i->embreeGeometryNeedsUpdate())
+      changed.push_back(i);
+  }
+
+  embree::parallel_for(changed.size(), [&](size_t i) {
+    changed[i]->embreeGeometryUpdate(RTC_BUILD_QUALITY_REFIT);
+  });
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+      "helide::World refitting TLS with %zu of %zu instances changed",
+      changed.size(),
+      m_instances.size());
+
+  commitTLS();
+}
+
+void World::commitTLS()
+{
+  const auto start = std::chrono::steady_clock::now();
   rtcCommitScene(m_embreeScene);
-  m_objectUpdates.lastTLSBuild = helium::newTimeStamp();
+  rtcCommitScene(m_embreeVolumeScene);
+  const auto end = std::chrono::steady_clock::now();
+  m_lastBuildTime = std::chrono::duration<float>(end - start).count();
+  m_objectUpdates.lastTLSCommit = helium::newTimeStamp();
+}
+
+std::vector<Group *> World::uniqueGroups() const
+{
+  std::vector<Group *> groups;
+  std::unordered_set<Group *> visited;
+  for (auto *inst : m_instances) {
+    auto *g = inst->group();
+    if (g && visited.insert(g).second)
+      groups.push_back(g);
+  }
+  return groups;
 }
 
 void World::cleanup()
 {
   rtcReleaseScene(m_embreeScene);
   m_embreeScene = nullptr;
+  rtcReleaseScene(m_embreeVolumeScene);
+  m_embreeVolumeScene = nullptr;
 }
 
 } // namespace helide
@@ -30,10 +30,23 @@ struct World : public Object
   RTCScene embreeScene() const;
   void embreeSceneUpdate();
 
+  struct UpdateTimes // seconds spent in each stage of the last update
+  {
+    float blsRebuild{0.f};
+    float blsCommit{0.f};
+    float tlsRebuild{0.f};
+  };
+
+  const UpdateTimes &lastUpdateTimes() const;
+
  private:
   void rebuildBLSs();
   void recommitBLSs();
   void rebuildTLS();
+  bool tlsInstancesChanged() const;
+  void refitTLS();
+  void commitTLS();
+  std::vector<Group *> uniqueGroups() const;
   void cleanup();
 
   helium::ChangeObserverPtr<ObjectArray> m_zeroSurfaceData;
@@ -53,11 +66,21 @@ struct World : public Object
   struct ObjectUpdates
   {
     helium::TimeStamp lastTLSBuild{0};
+    helium::TimeStamp lastTLSCommit{0};
     helium::TimeStamp lastBLSReconstructCheck{0};
     helium::TimeStamp lastBLSCommitCheck{0};
   } m_objectUpdates;
 
+  UpdateTimes m_updateTimes;
+
+  BVHSettings m_bvhSettings;
+  float m_lastBuildTime{0.f};
+
   RTCScene m_embreeScene{nullptr};
+  std::vector<bool> m_instanceAttached; // per instance ID in m_embreeScene
+
+  RTCScene m_embreeVolumeScene{nullptr};
+  std::vector<bool> m_instanceVolumesAttached; // ...in m_embreeVolumeScene
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Surface.h"
+#include "scene/Group.h"
 
 namespace helide {
 
@@ -29,6 +30,11 @@ const Geometry *Surface::geometry() const
   return m_geometry.ptr;
 }
 
+Geometry *Surface::geometry()
+{
+  return m_geometry.ptr;
+}
+
 const Material *Surface::material() const
 {
   return m_material.ptr;
@@ -74,13 +80,76 @@ float Surface::getSurfaceOpacity(const Ray &ray) const
     return geometry()->getAttributeValue(opacityAttribute, ray).x;
 }
 
+void Surface::getSurfaceColors(
+    const Ray *rays, uint32_t count, float4 *colors) const
+{
+  auto &state = *deviceState();
+  auto &imc = state.invalidMaterialColor;
+
+  auto *mat = material();
+
+  if (!mat) {
+    std::fill(colors, colors + count, float4(imc.x, imc.y, imc.z, 1.f));
+    return;
+  }
+
+  const auto colorAttribute = mat->colorAttribute();
+  const auto *colorSampler = mat->colorSampler();
+  if (colorSampler && colorSampler->isValid()) {
+    for (uint32_t i = 0; i < count; i++)
+      colors[i] = colorSampler->getSample(*geometry(), rays[i]);
+  } else if (colorAttribute == Attribute::NONE)
+    std::fill(colors, colors + count, material()->color());
+  else
+    geometry()->getAttributeValues(colorAttribute, rays, count, colors);
+}
+
+void Surface::getSurfaceOpacities(
+    const Ray *rays, uint32_t count, float *opacities) const
+{
+  thread_local std::vector<float4> values;
+
+  auto *mat = material();
+
+  if (!mat) {
+    std::fill(opacities, opacities + count, 0.f);
+    return;
+  }
+
+  const auto opacityAttribute = mat->opacityAttribute();
+  const auto *opacitySampler = mat->opacitySampler();
+  if (opacitySampler && opacitySampler->isValid()) {
+    for (uint32_t i = 0; i < count; i++)
+      opacities[i] = opacitySampler->getSample(*geometry(), rays[i]).x;
+  } else if (opacityAttribute == Attribute::NONE)
+    std::fill(opacities, opacities + count, material()->opacity());
+  else {
+    values.resize(count);
+    geometry()->getAttributeValues(
+        opacityAttribute, rays, count, values.data());
+    for (uint32_t i = 0; i < count; i++)
+      opacities[i] = values[i].x;
+  }
+}
+
 void Surface::markCommitted()
 {
   Object::markCommitted();
+  notifyChangeObservers();
   deviceState()->objectUpdates.lastBLSReconstructSceneRequest =
       helium::newTimeStamp();
 }
 
+void Surface::notifyChangeObserver(helium::BaseObject *o) const
+{
+  // Only the groups referencing this surface need to rebuild their BLS, so
+  // flag them directly rather than queueing them for a full re-commit
+  if (o->type() == ANARI_GROUP)
+    ((Group *)o)->markBLSReconstructRequested();
+  else
+    Object::notifyChangeObserver(o);
+}
+
 bool Surface::isValid() const
 {
   bool allowInvalidMaterial = deviceState()->allowInvalidSurfaceMaterials;
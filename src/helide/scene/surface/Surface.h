@@ -17,16 +17,26 @@ struct Surface : public Object
 
   uint32_t id() const;
   const Geometry *geometry() const;
+  Geometry *geometry();
   const Material *material() const;
 
   float4 getSurfaceColor(const Ray &ray) const;
   float getSurfaceOpacity(const Ray &ray) const;
 
+  // Same as above for each of 'count' rays hitting this surface, choosing the
+  // material's color or opacity source once for all of them
+  void getSurfaceColors(const Ray *rays, uint32_t count, float4 *colors) const;
+  void getSurfaceOpacities(
+      const Ray *rays, uint32_t count, float *opacities) const;
+
   float adjustedAlpha(float a) const;
 
   void markCommitted() override;
   bool isValid() const override;
 
+ protected:
+  void notifyChangeObserver(helium::BaseObject *o) const override;
+
  private:
   uint32_t m_id{~0u};
   helium::IntrusivePtr<Geometry> m_geometry;
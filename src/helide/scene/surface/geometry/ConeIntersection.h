@@ -0,0 +1,244 @@
+// Copyright 2022-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "HelideMath.h"
+// embree
+#include <embree3/rtcore.h>
+// std
+#include <string>
+
+namespace helide {
+
+// Analytic ray intersection for the cone and cylinder user geometries, where
+// a cylinder is the special case of both end radii being equal
+
+enum class ConeCap
+{
+  NONE,
+  FLAT,
+  ROUND
+};
+
+struct ConeHit
+{
+  float t;
+  float3 Ng;
+  float u; // 0 at the first vertex, 1 at the second
+};
+
+struct ConePrimitive
+{
+  float3 p0;
+  float3 p1;
+  float r0;
+  float r1;
+  ConeCap cap0;
+  ConeCap cap1;
+};
+
+// Cap settings resolved once per commit from 'caps', 'capStyle' and
+// 'vertex.cap', the latter taking precedence when present
+struct ConeCapSettings
+{
+  ConeCap first{ConeCap::NONE};
+  ConeCap second{ConeCap::NONE};
+  ConeCap style{ConeCap::FLAT};
+  const uint8_t *vertexCaps{nullptr};
+
+  void set(const std::string &caps, const std::string &capStyle);
+  void apply(ConePrimitive &c, uint2 idx) const;
+};
+
+inline void ConeCapSettings::set(
+    const std::string &caps, const std::string &capStyle)
+{
+  style = capStyle == "round" ? ConeCap::ROUND : ConeCap::FLAT;
+  first = caps == "first" || caps == "both" ? style : ConeCap::NONE;
+  second = caps == "second" || caps == "both" ? style : ConeCap::NONE;
+}
+
+inline void ConeCapSettings::apply(ConePrimitive &c, uint2 idx) const
+{
+  if (vertexCaps) {
+    c.cap0 = vertexCaps[idx.x] ? style : ConeCap::NONE;
+    c.cap1 = vertexCaps[idx.y] ? style : ConeCap::NONE;
+  } else {
+    c.cap0 = first;
+    c.cap1 = second;
+  }
+}
+
+inline box3 coneBounds(const ConePrimitive &c)
+{
+  return box3(linalg::min(c.p0 - c.r0, c.p1 - c.r1),
+      linalg::max(c.p0 + c.r0, c.p1 + c.r1));
+}
+
+inline void intersectConeSphereCap(const float3 &org,
+    const float3 &dir,
+    const float3 &center,
+    float r,
+    const float3 &axis,
+    float side,
+    float u,
+    float tnear,
+    ConeHit &hit)
+{
+  const float3 oc = org - center;
+  const float a = dot(dir, dir);
+  const float b = dot(oc, dir);
+  const float c = dot(oc, oc) - r * r;
+  const float disc = b * b - a * c;
+  if (disc < 0.f)
+    return;
+
+  const float sq = std::sqrt(disc);
+  for (float t : {(-b - sq) / a, (-b + sq) / a}) {
+    if (t < tnear || t >= hit.t)
+      continue;
+    // only the half of the sphere facing away from the body is a cap
+    const float3 n = oc + t * dir;
+    if (side * dot(n, axis) < 0.f)
+      continue;
+    hit = {t, n, u};
+    return;
+  }
+}
+
+inline void intersectConeDiskCap(const float3 &org,
+    const float3 &dir,
+    const float3 &center,
+    float r,
+    const float3 &axis,
+    float side,
+    float u,
+    float tnear,
+    ConeHit &hit)
+{
+  const float denom = dot(dir, axis);
+  if (denom == 0.f)
+    return;
+  const float t = dot(center - org, axis) / denom;
+  if (t < tnear || t >= hit.t)
+    return;
+  const float3 d = org + t * dir - center;
+  if (dot(d, d) <= r * r)
+    hit = {t, side * axis, u};
+}
+
+// Updates 'hit' when the closest intersection in [tnear, hit.t) is found
+inline bool intersectCone(const ConePrimitive &c,
+    const float3 &org,
+    const float3 &dir,
+    float tnear,
+    ConeHit &hit)
+{
+  const float tfar = hit.t;
+
+  const float3 ba = c.p1 - c.p0;
+  const float m0 = dot(ba, ba);
+  if (m0 == 0.f)
+    return false;
+
+  // Body: with q = org + t * dir - p0 and s = dot(q, ba), solve
+  //   |q|^2 - s^2 / m0 = (r0 + (r1 - r0) * s / m0)^2
+  // for t and keep the roots with the axial projection inside the segment
+  const float3 oa = org - c.p0;
+  const float dr = c.r1 - c.r0;
+  const float h = 1.f + dr * dr / m0;
+  const float m1 = dot(oa, ba);
+  const float m2 = dot(dir, ba);
+  const float m3 = dot(dir, oa);
+  const float m5 = dot(oa, oa);
+
+  const float A = m0 * dot(dir, dir) - m2 * m2 * h;
+  const float B = m0 * m3 - m1 * m2 * h - c.r0 * dr * m2;
+  const float C =
+      m0 * m5 - m1 * m1 * h - 2.f * c.r0 * dr * m1 - m0 * c.r0 * c.r0;
+  const float disc = B * B - A * C;
+
+  if (A != 0.f && disc >= 0.f) {
+    const float sq = std::sqrt(disc);
+    const float t0 = (-B - sq) / A;
+    const float t1 = (-B + sq) / A;
+    for (float t : {std::min(t0, t1), std::max(t0, t1)}) {
+      if (t < tnear || t >= hit.t)
+        continue;
+      const float s = m1 + t * m2;
+      if (s < 0.f || s > m0)
+        continue;
+      const float3 q = oa + t * dir;
+      hit = {t, q - ba * ((h * s + c.r0 * dr) / m0), s / m0};
+      break;
+    }
+  }
+
+  const float3 axis = ba / std::sqrt(m0);
+
+  if (c.cap0 == ConeCap::FLAT)
+    intersectConeDiskCap(org, dir, c.p0, c.r0, axis, -1.f, 0.f, tnear, hit);
+  else if (c.cap0 == ConeCap::ROUND)
+    intersectConeSphereCap(org, dir, c.p0, c.r0, axis, -1.f, 0.f, tnear, hit);
+
+  if (c.cap1 == ConeCap::FLAT)
+    intersectConeDiskCap(org, dir, c.p1, c.r1, axis, 1.f, 1.f, tnear, hit);
+  else if (c.cap1 == ConeCap::ROUND)
+    intersectConeSphereCap(org, dir, c.p1, c.r1, axis, 1.f, 1.f, tnear, hit);
+
+  return hit.t < tfar;
+}
+
+// Shared body of the embree intersect callbacks, 'primitive' returns the
+// ConePrimitive for a primitive ID of the geometry bound to 'args'
+template <typename PRIMITIVE_FCN>
+inline void intersectConeN(
+    const RTCIntersectFunctionNArguments *args, PRIMITIVE_FCN &&primitive)
+{
+  const ConePrimitive c = primitive(args->primID);
+  const auto N = args->N;
+  auto *rays = RTCRayHitN_RayN(args->rayhit, N);
+  auto *hits = RTCRayHitN_HitN(args->rayhit, N);
+
+  for (unsigned int i = 0; i < N; i++) {
+    if (args->valid[i] != -1)
+      continue;
+
+    const float3 org(RTCRayN_org_x(rays, N, i),
+        RTCRayN_org_y(rays, N, i),
+        RTCRayN_org_z(rays, N, i));
+    const float3 dir(RTCRayN_dir_x(rays, N, i),
+        RTCRayN_dir_y(rays, N, i),
+        RTCRayN_dir_z(rays, N, i));
+
+    float &tfar = RTCRayN_tfar(rays, N, i);
+    ConeHit hit{tfar, float3(0.f), 0.f};
+    if (!intersectCone(c, org, dir, RTCRayN_tnear(rays, N, i), hit))
+      continue;
+
+    tfar = hit.t;
+    RTCHitN_Ng_x(hits, N, i) = hit.Ng.x;
+    RTCHitN_Ng_y(hits, N, i) = hit.Ng.y;
+    RTCHitN_Ng_z(hits, N, i) = hit.Ng.z;
+    RTCHitN_u(hits, N, i) = hit.u;
+    RTCHitN_v(hits, N, i) = 0.f;
+    RTCHitN_primID(hits, N, i) = args->primID;
+    RTCHitN_geomID(hits, N, i) = args->geomID;
+    RTCHitN_instID(hits, N, i, 0) = args->context->instID[0];
+  }
+}
+
+inline void writeConeBounds(
+    const RTCBoundsFunctionArguments *args, const box3 &b)
+{
+  auto *out = args->bounds_o;
+  out->lower_x = b.lower.x;
+  out->lower_y = b.lower.y;
+  out->lower_z = b.lower.z;
+  out->upper_x = b.upper.x;
+  out->upper_y = b.upper.y;
+  out->upper_z = b.upper.z;
+}
+
+} // namespace helide
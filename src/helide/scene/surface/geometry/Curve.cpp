@@ -2,8 +2,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Curve.h"
-// std
-#include <numeric>
 
 namespace helide {
 
@@ -14,6 +12,11 @@ Curve::Curve(HelideGlobalState *s)
       rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_ROUND_LINEAR_CURVE);
 }
 
+bool Curve::isValid() const
+{
+  return m_vertexPosition;
+}
+
 void Curve::commit()
 {
   Geometry::commit();
@@ -33,28 +36,27 @@ void Curve::commit()
     return;
   }
 
-  const float *radius =
-      m_vertexRadius ? m_vertexRadius->beginAs<float>() : nullptr;
   m_globalRadius = getParam<float>("radius", 1.f);
 
   const auto numSegments =
       m_index ? m_index->size() : m_vertexPosition->size() / 2;
 
-  {
-    auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
-        RTC_BUFFER_TYPE_VERTEX,
-        0,
-        RTC_FORMAT_FLOAT4,
-        sizeof(float4),
-        m_vertexPosition->size());
-
-    const auto *begin = m_vertexPosition->beginAs<float3>();
-    const auto *end = m_vertexPosition->endAs<float3>();
-    uint32_t rID = 0;
-    std::transform(begin, end, vr, [&](const float3 &v) {
-      return float4(v, radius ? radius[rID++] : m_globalRadius);
-    });
-  }
+  const float *radius =
+      m_vertexRadius ? m_vertexRadius->beginAs<float>() : nullptr;
+
+  // embree curves interleave position and radius, which ANARI's separate
+  // arrays never do, so they always need this one conversion pass
+  auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
+      RTC_BUFFER_TYPE_VERTEX,
+      0,
+      RTC_FORMAT_FLOAT4,
+      sizeof(float4),
+      m_vertexPosition->size());
+
+  const auto *positions = m_vertexPosition->beginAs<float3>();
+  parallelForEachIndex(m_vertexPosition->size(), [&](size_t i) {
+    vr[i] = float4(positions[i], radius ? radius[i] : m_globalRadius);
+  });
 
   if (m_index) {
     rtcSetSharedGeometryBuffer(embreeGeometry(),
@@ -72,28 +74,12 @@ void Curve::commit()
         RTC_FORMAT_UINT,
         sizeof(uint32_t),
         numSegments);
-    std::iota(idx, idx + numSegments, 0);
+    parallelForEachIndex(numSegments, [&](size_t i) { idx[i] = uint32_t(i); });
   }
 
-  rtcCommitGeometry(embreeGeometry());
-}
-
-float4 Curve::getAttributeValue(const Attribute &attr, const Ray &ray) const
-{
-  if (attr == Attribute::NONE)
-    return DEFAULT_ATTRIBUTE_VALUE;
+  cacheVertexAttributes(AttributeTopology::SEGMENT, m_index.get());
 
-  auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
-    return Geometry::getAttributeValue(attr, ray);
-
-  auto idx = m_index ? *(m_index->dataAs<uint32_t>() + ray.primID) : ray.primID;
-
-  auto a = readAttributeValue(attributeArray, idx + 0);
-  auto b = readAttributeValue(attributeArray, idx + 1);
-
-  return a + (b - a) * ray.u;
+  rtcCommitGeometry(embreeGeometry());
 }
 
 } // namespace helide
@@ -12,15 +12,12 @@ struct Curve : public Geometry
   Curve(HelideGlobalState *s);
 
   void commit() override;
-
-  float4 getAttributeValue(
-      const Attribute &attr, const Ray &ray) const override;
+  bool isValid() const override;
 
  private:
   helium::ChangeObserverPtr<Array1D> m_index;
   helium::ChangeObserverPtr<Array1D> m_vertexPosition;
   helium::ChangeObserverPtr<Array1D> m_vertexRadius;
-  std::array<helium::IntrusivePtr<Array1D>, 5> m_vertexAttributes;
   float m_globalRadius{0.f};
 };
 
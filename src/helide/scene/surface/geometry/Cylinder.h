@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "ConeIntersection.h"
 #include "Geometry.h"
 
 namespace helide {
@@ -12,16 +13,23 @@ struct Cylinder : public Geometry
   Cylinder(HelideGlobalState *s);
 
   void commit() override;
-
-  float4 getAttributeValue(
-      const Attribute &attr, const Ray &ray) const override;
+  bool isValid() const override;
 
  private:
+  ConePrimitive primitive(uint32_t primID) const;
+
+  static void embreeBounds(const RTCBoundsFunctionArguments *args);
+  static void embreeIntersect(const RTCIntersectFunctionNArguments *args);
+
   helium::ChangeObserverPtr<Array1D> m_index;
   helium::ChangeObserverPtr<Array1D> m_radius;
   helium::ChangeObserverPtr<Array1D> m_vertexPosition;
-  std::array<helium::IntrusivePtr<Array1D>, 5> m_vertexAttributes;
+  helium::ChangeObserverPtr<Array1D> m_vertexCap;
+  const float3 *m_positions{nullptr};
+  const float *m_radii{nullptr};
+  const uint2 *m_indices{nullptr};
   float m_globalRadius{0.f};
+  ConeCapSettings m_caps;
 };
 
 } // namespace helide
@@ -9,13 +9,19 @@
 #include "Quad.h"
 #include "Sphere.h"
 #include "Triangle.h"
+// helide
+#include "scene/Group.h"
 // std
 #include <cstring>
 #include <limits>
 
 namespace helide {
 
-Geometry::Geometry(HelideGlobalState *s) : Object(ANARI_GEOMETRY, s) {}
+Geometry::Geometry(HelideGlobalState *s)
+    : Object(ANARI_GEOMETRY, s),
+      m_primitiveAttr{this, this, this, this, this},
+      m_vertexAttributes{this, this, this, this, this}
+{}
 
 Geometry::~Geometry()
 {
@@ -58,23 +64,97 @@ void Geometry::commit()
   m_primitiveAttr[2] = getParamObject<Array1D>("primitive.attribute2");
   m_primitiveAttr[3] = getParamObject<Array1D>("primitive.attribute3");
   m_primitiveAttr[4] = getParamObject<Array1D>("primitive.color");
+
+  for (int i = 0; i < 5; i++) {
+    cacheAttribute(m_primitiveAttrCache[i], m_primitiveAttr[i].get());
+    cacheAttribute(m_vertexAttrCache[i], nullptr);
+  }
+  m_attributePositions = nullptr;
 }
 
 void Geometry::markCommitted()
 {
   Object::markCommitted();
-  deviceState()->objectUpdates.lastBLSCommitSceneRequest =
-      helium::newTimeStamp();
+
+  // Groups only attach valid geometries, so a change in validity alters which
+  // surfaces are in their BLS rather than just the data of one of them
+  const bool valid = isValid();
+  m_validityChanged = valid != m_validAtLastCommit;
+  m_validAtLastCommit = valid;
+
+  notifyChangeObservers();
+  auto &updates = deviceState()->objectUpdates;
+  updates.lastBLSCommitSceneRequest = helium::newTimeStamp();
+  if (m_validityChanged)
+    updates.lastBLSReconstructSceneRequest = helium::newTimeStamp();
+}
+
+void Geometry::notifyChangeObserver(helium::BaseObject *o) const
+{
+  // Only the groups referencing this geometry need to update their BLS, so
+  // flag them directly rather than queueing them for a full re-commit
+  if (o->type() == ANARI_GROUP) {
+    auto *g = (Group *)o;
+    if (m_validityChanged)
+      g->markBLSReconstructRequested();
+    else
+      g->markBLSCommitRequested();
+  } else
+    Object::notifyChangeObserver(o);
+}
+
+void Geometry::cacheVertexAttributes(AttributeTopology topology,
+    const Array1D *index,
+    const float3 *positions)
+{
+  m_attributeTopology = topology;
+  m_attributeIndex = index ? (const uint32_t *)index->begin() : nullptr;
+  m_attributePositions = positions;
+
+  switch (topology) {
+  case AttributeTopology::LINE:
+    m_attributeIndexStride = 2;
+    break;
+  case AttributeTopology::TRIANGLE:
+    m_attributeIndexStride = 3;
+    break;
+  case AttributeTopology::QUAD:
+    m_attributeIndexStride = 4;
+    break;
+  case AttributeTopology::POINT:
+  case AttributeTopology::SEGMENT:
+  default:
+    m_attributeIndexStride = 1;
+    break;
+  }
+
+  for (int i = 0; i < 5; i++)
+    cacheAttribute(m_vertexAttrCache[i], m_vertexAttributes[i].get());
 }
 
-float4 Geometry::getAttributeValue(const Attribute &attr, const Ray &ray) const
+void Geometry::cacheAttribute(AttributeCache &cache, const Array1D *array)
 {
-  if (attr == Attribute::NONE)
-    return DEFAULT_ATTRIBUTE_VALUE;
+  cache.data = nullptr;
+  cache.size = 0;
+  cache.storage.clear();
+
+  if (!array || array->size() == 0)
+    return;
+
+  cache.size = uint32_t(array->size());
+
+  if (array->elementType() == ANARI_FLOAT32_VEC4) {
+    cache.data = array->beginAs<float4>();
+    return;
+  }
 
-  auto attrIdx = static_cast<int>(attr);
-  return readAttributeValue(
-      m_primitiveAttr[attrIdx].ptr, ray.primID, m_uniformAttr[attrIdx]);
+  cache.storage.resize(cache.size);
+  const auto *begin = array->begin();
+  const auto type = array->elementType();
+  parallelForEachIndex(cache.size, [&](size_t i) {
+    cache.storage[i] = readAsAttributeValueFlat(begin, type, i);
+  });
+  cache.data = cache.storage.data();
 }
 
 } // namespace helide
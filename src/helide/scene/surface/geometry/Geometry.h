@@ -5,11 +5,29 @@
 
 #include "Object.h"
 #include "array/Array1D.h"
+// embree
+#include "algorithms/parallel_for.h"
 // std
+#include <algorithm>
 #include <array>
+#include <type_traits>
+#include <vector>
 
 namespace helide {
 
+// Calls 'f(i)' for each i in [0, n) on embree's task scheduler, in chunks big
+// enough that the per-task overhead stays negligible for huge arrays
+template <typename FCN>
+inline void parallelForEachIndex(size_t n, FCN &&f)
+{
+  constexpr size_t GRAIN_SIZE = 16384;
+  embree::parallel_for(
+      size_t(0), n, GRAIN_SIZE, [&](const embree::range<size_t> &r) {
+        for (size_t i = r.begin(); i < r.end(); i++)
+          f(i);
+      });
+}
+
 struct Geometry : public Object
 {
   Geometry(HelideGlobalState *s);
@@ -23,15 +41,232 @@ struct Geometry : public Object
   void commit() override;
   void markCommitted() override;
 
-  virtual float4 getAttributeValue(const Attribute &attr, const Ray &ray) const;
+  float4 getAttributeValue(const Attribute &attr, const Ray &ray) const;
+  // Same as getAttributeValue() for each of 'count' rays hitting this geometry,
+  // choosing the attribute source and interpolation once for all of them
+  void getAttributeValues(const Attribute &attr,
+      const Ray *rays,
+      uint32_t count,
+      float4 *values) const;
+
+  // Positions and vertex attribute values at three corners of the hit
+  // triangle or quad, from which samplers size their filter footprint
+  bool getAttributeCorners(const Attribute &attr,
+      const Ray &ray,
+      float3 positions[3],
+      float4 values[3]) const;
 
  protected:
+  // How the vertices feeding a primitive's vertex attributes are found and
+  // blended, which lets getAttributeValue() stay non-virtual
+  enum class AttributeTopology
+  {
+    POINT, // one vertex per primitive
+    SEGMENT, // index names the first of two consecutive vertices
+    LINE, // two indexed vertices, lerp by 'u'
+    TRIANGLE, // three indexed vertices, barycentric 'u'/'v'
+    QUAD // four indexed vertices, bilinear 'u'/'v'
+  };
+
+  // Attribute values normalized to float4, shared with the array when it
+  // already holds float4 and converted once per commit otherwise
+  struct AttributeCache
+  {
+    const float4 *data{nullptr};
+    uint32_t size{0};
+    std::vector<float4> storage;
+
+    float4 at(uint32_t i) const;
+  };
+
+  void notifyChangeObserver(helium::BaseObject *o) const override;
+
+  // Called by subtypes once 'm_vertexAttributes' and the index are set
+  void cacheVertexAttributes(AttributeTopology topology,
+      const Array1D *index = nullptr,
+      const float3 *positions = nullptr);
+
   RTCGeometry m_embreeGeometry{nullptr};
 
   std::array<float4, 5> m_uniformAttr;
-  std::array<helium::IntrusivePtr<Array1D>, 5> m_primitiveAttr;
+  std::array<helium::ChangeObserverPtr<Array1D>, 5> m_primitiveAttr;
+  std::array<helium::ChangeObserverPtr<Array1D>, 5> m_vertexAttributes;
+
+ private:
+  static void cacheAttribute(AttributeCache &cache, const Array1D *array);
+  uint32_t attributeVertex(uint32_t primID, uint32_t i) const;
+  template <AttributeTopology TOPOLOGY>
+  using Topology = std::integral_constant<AttributeTopology, TOPOLOGY>;
+  template <AttributeTopology TOPOLOGY>
+  float4 interpolateVertexAttribute(
+      const AttributeCache &cache, const Ray &ray) const;
+  float4 interpolateVertexAttribute(
+      const AttributeCache &cache, const Ray &ray) const;
+  void interpolateVertexAttributes(const AttributeCache &cache,
+      const Ray *rays,
+      uint32_t count,
+      float4 *values) const;
+
+  std::array<AttributeCache, 5> m_primitiveAttrCache;
+  std::array<AttributeCache, 5> m_vertexAttrCache;
+  AttributeTopology m_attributeTopology{AttributeTopology::POINT};
+  const uint32_t *m_attributeIndex{nullptr};
+  uint32_t m_attributeIndexStride{1};
+  const float3 *m_attributePositions{nullptr};
+  bool m_validAtLastCommit{false};
+  bool m_validityChanged{false};
 };
 
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline float4 Geometry::AttributeCache::at(uint32_t i) const
+{
+  // clamp like Array1D::readAsAttributeValue() does by default
+  return data[std::min(i, size - 1)];
+}
+
+inline float4 Geometry::getAttributeValue(
+    const Attribute &attr, const Ray &ray) const
+{
+  if (attr == Attribute::NONE)
+    return DEFAULT_ATTRIBUTE_VALUE;
+
+  const auto attrIdx = static_cast<int>(attr);
+  const auto &vertexAttr = m_vertexAttrCache[attrIdx];
+  if (vertexAttr.data)
+    return interpolateVertexAttribute(vertexAttr, ray);
+
+  const auto &primitiveAttr = m_primitiveAttrCache[attrIdx];
+  return primitiveAttr.data ? primitiveAttr.at(ray.primID)
+                            : m_uniformAttr[attrIdx];
+}
+
+inline void Geometry::getAttributeValues(const Attribute &attr,
+    const Ray *rays,
+    uint32_t count,
+    float4 *values) const
+{
+  if (attr == Attribute::NONE) {
+    std::fill(values, values + count, DEFAULT_ATTRIBUTE_VALUE);
+    return;
+  }
+
+  const auto attrIdx = static_cast<int>(attr);
+  const auto &vertexAttr = m_vertexAttrCache[attrIdx];
+  const auto &primitiveAttr = m_primitiveAttrCache[attrIdx];
+  if (vertexAttr.data)
+    interpolateVertexAttributes(vertexAttr, rays, count, values);
+  else if (primitiveAttr.data) {
+    for (uint32_t i = 0; i < count; i++)
+      values[i] = primitiveAttr.at(rays[i].primID);
+  } else
+    std::fill(values, values + count, m_uniformAttr[attrIdx]);
+}
+
+inline bool Geometry::getAttributeCorners(const Attribute &attr,
+    const Ray &ray,
+    float3 positions[3],
+    float4 values[3]) const
+{
+  if (attr == Attribute::NONE || !m_attributePositions)
+    return false;
+
+  const auto &vertexAttr = m_vertexAttrCache[static_cast<int>(attr)];
+  if (!vertexAttr.data)
+    return false;
+
+  for (uint32_t i = 0; i < 3; i++) {
+    const auto v = attributeVertex(ray.primID, i);
+    positions[i] = m_attributePositions[v];
+    values[i] = vertexAttr.at(v);
+  }
+
+  return true;
+}
+
+inline uint32_t Geometry::attributeVertex(uint32_t primID, uint32_t i) const
+{
+  if (!m_attributeIndex)
+    return primID * m_attributeIndexStride + i;
+  else if (m_attributeTopology == AttributeTopology::SEGMENT)
+    return m_attributeIndex[primID] + i;
+  else
+    return m_attributeIndex[primID * m_attributeIndexStride + i];
+}
+
+template <Geometry::AttributeTopology TOPOLOGY>
+inline float4 Geometry::interpolateVertexAttribute(
+    const AttributeCache &cache, const Ray &ray) const
+{
+  const auto v = [&](uint32_t i) {
+    return cache.at(attributeVertex(ray.primID, i));
+  };
+
+  if constexpr (TOPOLOGY == AttributeTopology::SEGMENT
+      || TOPOLOGY == AttributeTopology::LINE) {
+    const auto a = v(0);
+    return a + (v(1) - a) * ray.u;
+  } else if constexpr (TOPOLOGY == AttributeTopology::TRIANGLE) {
+    return (1.f - ray.u - ray.v) * v(0) + ray.u * v(1) + ray.v * v(2);
+  } else if constexpr (TOPOLOGY == AttributeTopology::QUAD) {
+    return (1.f - ray.v) * (1.f - ray.u) * v(0)
+        + (1.f - ray.v) * ray.u * v(1) + ray.v * ray.u * v(2)
+        + ray.v * (1.f - ray.u) * v(3);
+  } else {
+    return v(0);
+  }
+}
+
+inline float4 Geometry::interpolateVertexAttribute(
+    const AttributeCache &cache, const Ray &ray) const
+{
+  switch (m_attributeTopology) {
+  case AttributeTopology::SEGMENT:
+    return interpolateVertexAttribute<AttributeTopology::SEGMENT>(cache, ray);
+  case AttributeTopology::LINE:
+    return interpolateVertexAttribute<AttributeTopology::LINE>(cache, ray);
+  case AttributeTopology::TRIANGLE:
+    return interpolateVertexAttribute<AttributeTopology::TRIANGLE>(cache, ray);
+  case AttributeTopology::QUAD:
+    return interpolateVertexAttribute<AttributeTopology::QUAD>(cache, ray);
+  case AttributeTopology::POINT:
+  default:
+    return interpolateVertexAttribute<AttributeTopology::POINT>(cache, ray);
+  }
+}
+
+inline void Geometry::interpolateVertexAttributes(const AttributeCache &cache,
+    const Ray *rays,
+    uint32_t count,
+    float4 *values) const
+{
+  // the topology is resolved once, outside the loop over all rays
+  const auto interpolateAll = [&](auto topology) {
+    for (uint32_t i = 0; i < count; i++)
+      values[i] = interpolateVertexAttribute<decltype(topology)::value>(
+          cache, rays[i]);
+  };
+
+  switch (m_attributeTopology) {
+  case AttributeTopology::SEGMENT:
+    interpolateAll(Topology<AttributeTopology::SEGMENT>());
+    break;
+  case AttributeTopology::LINE:
+    interpolateAll(Topology<AttributeTopology::LINE>());
+    break;
+  case AttributeTopology::TRIANGLE:
+    interpolateAll(Topology<AttributeTopology::TRIANGLE>());
+    break;
+  case AttributeTopology::QUAD:
+    interpolateAll(Topology<AttributeTopology::QUAD>());
+    break;
+  case AttributeTopology::POINT:
+  default:
+    interpolateAll(Topology<AttributeTopology::POINT>());
+    break;
+  }
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_SPECIALIZATION(helide::Geometry *, ANARI_GEOMETRY);
@@ -2,8 +2,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Quad.h"
-// std
-#include <numeric>
 
 namespace helide {
 
@@ -13,6 +11,11 @@ Quad::Quad(HelideGlobalState *s)
   m_embreeGeometry = rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_QUAD);
 }
 
+bool Quad::isValid() const
+{
+  return m_vertexPosition;
+}
+
 void Quad::commit()
 {
   Geometry::commit();
@@ -57,38 +60,14 @@ void Quad::commit()
         RTC_FORMAT_UINT4,
         sizeof(uint4),
         numQuads);
-    std::iota(vr, vr + (numQuads * 4), 0);
+    parallelForEachIndex(numQuads * 4, [&](size_t i) { vr[i] = uint32_t(i); });
   }
 
-  rtcCommitGeometry(embreeGeometry());
-}
-
-float4 Quad::getAttributeValue(const Attribute &attr, const Ray &ray) const
-{
-  if (attr == Attribute::NONE)
-    return DEFAULT_ATTRIBUTE_VALUE;
+  cacheVertexAttributes(AttributeTopology::QUAD,
+      m_index.get(),
+      m_vertexPosition->dataAs<float3>());
 
-  auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
-    return Geometry::getAttributeValue(attr, ray);
-
-  const float3 uvw(1.0f - ray.u - ray.v, ray.u, ray.v);
-
-  auto idx = m_index ? *(m_index->dataAs<uint4>() + ray.primID)
-                     : 4 * ray.primID + uint4(0, 1, 2, 3);
-
-  float4 uv((1 - ray.v) * (1 - ray.u),
-      (1 - ray.v) * ray.u,
-      ray.v * ray.u,
-      ray.v * (1 - ray.u));
-
-  auto a = readAttributeValue(attributeArray, idx.x);
-  auto b = readAttributeValue(attributeArray, idx.y);
-  auto c = readAttributeValue(attributeArray, idx.z);
-  auto d = readAttributeValue(attributeArray, idx.w);
-
-  return uv.x * a + uv.y * b + uv.z * c + uv.w * d;
+  rtcCommitGeometry(embreeGeometry());
 }
 
 } // namespace helide
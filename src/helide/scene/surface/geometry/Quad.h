@@ -12,14 +12,11 @@ struct Quad : public Geometry
   Quad(HelideGlobalState *s);
 
   void commit() override;
-
-  float4 getAttributeValue(
-      const Attribute &attr, const Ray &ray) const override;
+  bool isValid() const override;
 
  private:
   helium::ChangeObserverPtr<Array1D> m_index;
   helium::ChangeObserverPtr<Array1D> m_vertexPosition;
-  std::array<helium::IntrusivePtr<Array1D>, 5> m_vertexAttributes;
 };
 
 } // namespace helide
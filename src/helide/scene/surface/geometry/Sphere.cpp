@@ -12,6 +12,11 @@ Sphere::Sphere(HelideGlobalState *s)
       rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_SPHERE_POINT);
 }
 
+bool Sphere::isValid() const
+{
+  return m_vertexPosition;
+}
+
 void Sphere::commit()
 {
   Geometry::commit();
@@ -39,6 +44,8 @@ void Sphere::commit()
 
   const auto numSpheres = m_index ? m_index->size() : m_vertexPosition->size();
 
+  // embree points interleave position and radius, which ANARI's separate
+  // arrays never do, so they always need this one conversion pass
   auto *vr = (float4 *)rtcSetNewGeometryBuffer(embreeGeometry(),
       RTC_BUFFER_TYPE_VERTEX,
       0,
@@ -46,50 +53,16 @@ void Sphere::commit()
       sizeof(float4),
       numSpheres);
 
-  m_attributeIndex.clear();
-
-  if (m_index) {
-    m_attributeIndex.reserve(m_index->size());
+  const auto *positions = m_vertexPosition->beginAs<float3>();
+  const auto *index = m_index ? m_index->beginAs<uint32_t>() : nullptr;
+  parallelForEachIndex(numSpheres, [&](size_t i) {
+    const uint32_t v = index ? index[i] : uint32_t(i);
+    vr[i] = float4(positions[v], radius ? radius[v] : m_globalRadius);
+  });
 
-    const auto *begin = m_index->beginAs<uint32_t>();
-    const auto *end = m_index->endAs<uint32_t>();
-    const auto *vertices = m_vertexPosition->beginAs<float3>();
-
-    size_t sphereID = 0;
-    std::transform(begin, end, vr, [&](uint32_t i) {
-      m_attributeIndex.push_back(i);
-      const auto &v = vertices[i];
-      const float r = radius ? radius[i] : m_globalRadius;
-      return float4(v.x, v.y, v.z, r);
-    });
-  } else {
-    const auto *begin = m_vertexPosition->beginAs<float3>();
-    const auto *end = m_vertexPosition->endAs<float3>();
-
-    size_t sphereID = 0;
-    std::transform(begin, end, vr, [&](const float3 &v) {
-      const float r = radius ? radius[sphereID++] : m_globalRadius;
-      return float4(v.x, v.y, v.z, r);
-    });
-  }
+  cacheVertexAttributes(AttributeTopology::POINT, m_index.get());
 
   rtcCommitGeometry(embreeGeometry());
 }
 
-float4 Sphere::getAttributeValue(const Attribute &attr, const Ray &ray) const
-{
-  if (attr == Attribute::NONE)
-    return Geometry::getAttributeValue(attr, ray);
-
-  auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
-    return Geometry::getAttributeValue(attr, ray);
-
-  const auto primID =
-      m_attributeIndex.empty() ? ray.primID : m_attributeIndex[ray.primID];
-
-  return readAttributeValue(attributeArray, primID);
-}
-
 } // namespace helide
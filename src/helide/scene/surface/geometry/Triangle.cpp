@@ -2,8 +2,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Triangle.h"
-// std
-#include <numeric>
 
 namespace helide {
 
@@ -14,6 +12,11 @@ Triangle::Triangle(HelideGlobalState *s)
       rtcNewGeometry(s->embreeDevice, RTC_GEOMETRY_TYPE_TRIANGLE);
 }
 
+bool Triangle::isValid() const
+{
+  return m_vertexPosition;
+}
+
 void Triangle::commit()
 {
   Geometry::commit();
@@ -58,32 +61,14 @@ void Triangle::commit()
         RTC_FORMAT_UINT3,
         sizeof(uint3),
         numTris);
-    std::iota(vr, vr + (numTris * 3), 0);
+    parallelForEachIndex(numTris * 3, [&](size_t i) { vr[i] = uint32_t(i); });
   }
 
-  rtcCommitGeometry(embreeGeometry());
-}
-
-float4 Triangle::getAttributeValue(const Attribute &attr, const Ray &ray) const
-{
-  if (attr == Attribute::NONE)
-    return DEFAULT_ATTRIBUTE_VALUE;
-
-  auto attrIdx = static_cast<int>(attr);
-  auto *attributeArray = m_vertexAttributes[attrIdx].ptr;
-  if (!attributeArray)
-    return Geometry::getAttributeValue(attr, ray);
-
-  const float3 uvw(1.0f - ray.u - ray.v, ray.u, ray.v);
+  cacheVertexAttributes(AttributeTopology::TRIANGLE,
+      m_index.get(),
+      m_vertexPosition->dataAs<float3>());
 
-  auto idx = m_index ? *(m_index->dataAs<uint3>() + ray.primID)
-                     : 3 * ray.primID + uint3(0, 1, 2);
-
-  auto a = readAttributeValue(attributeArray, idx.x);
-  auto b = readAttributeValue(attributeArray, idx.y);
-  auto c = readAttributeValue(attributeArray, idx.z);
-
-  return uvw.x * a + uvw.y * b + uvw.z * c;
+  rtcCommitGeometry(embreeGeometry());
 }
 
 } // namespace helide
@@ -0,0 +1,681 @@
+// Copyright 2022-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "BlockCompression.h"
+// std
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace helide {
+
+// Helper types/functions /////////////////////////////////////////////////////
+
+namespace {
+
+// Little-endian bit stream over one 128-bit block
+struct BlockBits
+{
+  BlockBits(const uint8_t *block)
+  {
+    for (int i = 7; i >= 0; i--) {
+      lo = (lo << 8) | block[i];
+      hi = (hi << 8) | block[i + 8];
+    }
+  }
+
+  uint32_t read(uint32_t n)
+  {
+    uint64_t v = 0;
+    if (pos >= 64)
+      v = hi >> (pos - 64);
+    else if (pos == 0)
+      v = lo;
+    else
+      v = (lo >> pos) | (hi << (64 - pos));
+    pos += n;
+    return uint32_t(v & ((uint64_t(1) << n) - 1));
+  }
+
+  uint64_t lo{0};
+  uint64_t hi{0};
+  uint32_t pos{0};
+};
+
+uint64_t readLE(const uint8_t *bytes, int n)
+{
+  uint64_t v = 0;
+  for (int i = n - 1; i >= 0; i--)
+    v = (v << 8) | bytes[i];
+  return v;
+}
+
+int32_t signExtend(int32_t v, uint32_t bits)
+{
+  const int32_t shift = 32 - int32_t(bits);
+  return int32_t(uint32_t(v) << shift) >> shift;
+}
+
+float halfToFloat(uint16_t h)
+{
+  const uint32_t sign = uint32_t(h & 0x8000) << 16;
+  uint32_t exponent = (h >> 10) & 0x1f;
+  uint32_t mantissa = h & 0x3ff;
+
+  uint32_t bits = 0;
+  if (exponent == 0x1f) {
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  } else if (exponent != 0) {
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  } else if (mantissa != 0) {
+    // renormalize a denormal half
+    exponent = 113;
+    while (!(mantissa & 0x400)) {
+      mantissa <<= 1;
+      exponent--;
+    }
+    bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+  } else {
+    bits = sign;
+  }
+
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+float4 unpack565(uint32_t c)
+{
+  return float4(((c >> 11) & 0x1f) / 31.f,
+      ((c >> 5) & 0x3f) / 63.f,
+      (c & 0x1f) / 31.f,
+      1.f);
+}
+
+// BC1 color block, also the color half of BC2/BC3 which always use the four
+// color palette
+void decodeColorBlock(
+    const uint8_t *block, bool threeColorMode, bool punchThrough, float4 *out)
+{
+  const auto c0 = uint32_t(readLE(block, 2));
+  const auto c1 = uint32_t(readLE(block + 2, 2));
+
+  float4 palette[4];
+  palette[0] = unpack565(c0);
+  palette[1] = unpack565(c1);
+  if (!threeColorMode || c0 > c1) {
+    palette[2] = (2.f * palette[0] + palette[1]) / 3.f;
+    palette[3] = (palette[0] + 2.f * palette[1]) / 3.f;
+  } else {
+    palette[2] = (palette[0] + palette[1]) * 0.5f;
+    palette[3] = float4(0.f, 0.f, 0.f, punchThrough ? 0.f : 1.f);
+  }
+
+  const auto indices = uint32_t(readLE(block + 4, 4));
+  for (int i = 0; i < 16; i++)
+    out[i] = palette[(indices >> (2 * i)) & 3];
+}
+
+// BC4 single channel block, also the alpha of BC3 and each channel of BC5
+void decodeChannelBlock(const uint8_t *block, bool snorm, float *out)
+{
+  float palette[8];
+  bool sixValueMode = false;
+  if (snorm) {
+    const int32_t e0 = std::max(int32_t(int8_t(block[0])), -127);
+    const int32_t e1 = std::max(int32_t(int8_t(block[1])), -127);
+    palette[0] = e0 / 127.f;
+    palette[1] = e1 / 127.f;
+    sixValueMode = e0 <= e1;
+  } else {
+    palette[0] = block[0] / 255.f;
+    palette[1] = block[1] / 255.f;
+    sixValueMode = block[0] <= block[1];
+  }
+
+  if (sixValueMode) {
+    for (int i = 2; i < 6; i++)
+      palette[i] = ((6 - i) * palette[0] + (i - 1) * palette[1]) / 5.f;
+    palette[6] = snorm ? -1.f : 0.f;
+    palette[7] = 1.f;
+  } else {
+    for (int i = 2; i < 8; i++)
+      palette[i] = ((8 - i) * palette[0] + (i - 1) * palette[1]) / 7.f;
+  }
+
+  const uint64_t indices = readLE(block + 2, 6);
+  for (int i = 0; i < 16; i++)
+    out[i] = palette[(indices >> (3 * i)) & 7];
+}
+
+// BC6H/BC7 shared tables (partition masks store the subset of texel i in bit
+// i, or bits 2i..2i+1 for three subsets) //////////////////////////////////////
+
+constexpr uint16_t PARTITIONS2[64] = {0xCCCC, 0x8888, 0xEEEE, 0xECC8,
+    0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8,
+    0xFF00, 0xFFF0, 0xF000, 0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310,
+    0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E,
+    0x399C, 0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+    0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660, 0x0272,
+    0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6,
+    0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22};
+
+constexpr uint32_t PARTITIONS3[64] = {0xAA685050, 0x6A5A5040, 0x5A5A4200,
+    0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050, 0xAA550000,
+    0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450,
+    0x2A0A4250, 0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454,
+    0x6A6A4040, 0xA4A45000, 0x1A1A0500, 0x0050A4A4, 0xAAA59090, 0x14696914,
+    0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200, 0xA9A58000,
+    0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224,
+    0x50A50A50, 0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0,
+    0x69286928, 0x44AAAA44, 0x66666600, 0xAA444444, 0x54A854A8, 0x95809580,
+    0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000, 0xAAAA1414,
+    0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44,
+    0x2A4A5254};
+
+// index of the texel whose index omits its top bit, per partition and subset
+constexpr uint8_t ANCHORS2[64] = {15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2, 15,
+    15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6, 6, 2, 6, 8, 15, 15, 2, 2,
+    15, 15, 15, 15, 15, 2, 2, 15};
+
+constexpr uint8_t ANCHORS3_1[64] = {3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6,
+    5, 3, 3, 3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15, 8, 15, 3, 5,
+    6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15, 3, 15, 5, 5, 5, 8, 5, 10, 5,
+    10, 8, 13, 15, 12, 3, 3};
+
+constexpr uint8_t ANCHORS3_2[64] = {15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15,
+    15, 15, 15, 8, 15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8, 15,
+    3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8, 15, 3, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 3, 15, 15, 8};
+
+constexpr uint8_t WEIGHTS2[4] = {0, 21, 43, 64};
+constexpr uint8_t WEIGHTS3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+constexpr uint8_t WEIGHTS4[16] = {
+    0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+const uint8_t *weightsForBits(uint32_t bits)
+{
+  return bits == 2 ? WEIGHTS2 : (bits == 3 ? WEIGHTS3 : WEIGHTS4);
+}
+
+int32_t interpolate(int32_t e0, int32_t e1, uint32_t weight)
+{
+  return ((64 - int32_t(weight)) * e0 + int32_t(weight) * e1 + 32) >> 6;
+}
+
+// BC7 ////////////////////////////////////////////////////////////////////////
+
+struct BC7Mode
+{
+  uint8_t numSubsets;
+  uint8_t partitionBits;
+  uint8_t rotationBits;
+  uint8_t indexSelectionBits;
+  uint8_t colorBits;
+  uint8_t alphaBits;
+  uint8_t endpointPBits;
+  uint8_t sharedPBits;
+  uint8_t indexBits;
+  uint8_t secondaryIndexBits;
+};
+
+constexpr BC7Mode BC7_MODES[8] = {{3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+    {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+    {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+    {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+    {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+    {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+    {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+    {2, 6, 0, 0, 5, 5, 1, 0, 2, 0}};
+
+void decodeBC7(const uint8_t *block, float4 *out)
+{
+  BlockBits bits(block);
+
+  uint32_t mode = 0;
+  while (mode < 8 && bits.read(1) == 0)
+    mode++;
+  if (mode == 8) {
+    // reserved mode
+    std::fill(out, out + 16, float4(0.f));
+    return;
+  }
+
+  const auto &m = BC7_MODES[mode];
+  const uint32_t partition = bits.read(m.partitionBits);
+  const uint32_t rotation = bits.read(m.rotationBits);
+  const uint32_t indexSelection = bits.read(m.indexSelectionBits);
+
+  // endpoints are stored channel by channel, then per subset
+  const uint32_t numEndpoints = 2u * m.numSubsets;
+  int32_t endpoints[6][4] = {};
+  for (uint32_t c = 0; c < 3; c++) {
+    for (uint32_t e = 0; e < numEndpoints; e++)
+      endpoints[e][c] = bits.read(m.colorBits);
+  }
+  for (uint32_t e = 0; e < numEndpoints && m.alphaBits; e++)
+    endpoints[e][3] = bits.read(m.alphaBits);
+
+  uint32_t colorBits = m.colorBits;
+  uint32_t alphaBits = m.alphaBits;
+  if (m.endpointPBits || m.sharedPBits) {
+    uint32_t pbits[6] = {};
+    if (m.endpointPBits) {
+      for (uint32_t e = 0; e < numEndpoints; e++)
+        pbits[e] = bits.read(1);
+    } else {
+      for (uint32_t s = 0; s < m.numSubsets; s++)
+        pbits[2 * s] = pbits[2 * s + 1] = bits.read(1);
+    }
+    for (uint32_t e = 0; e < numEndpoints; e++) {
+      for (uint32_t c = 0; c < 4; c++)
+        endpoints[e][c] = (endpoints[e][c] << 1) | pbits[e];
+    }
+    colorBits++;
+    if (alphaBits)
+      alphaBits++;
+  }
+
+  for (uint32_t e = 0; e < numEndpoints; e++) {
+    for (uint32_t c = 0; c < 4; c++) {
+      auto &v = endpoints[e][c];
+      const uint32_t n = c < 3 ? colorBits : alphaBits;
+      if (n == 0)
+        v = 255;
+      else
+        v = (v << (8 - n)) | (v >> (2 * n - 8));
+    }
+  }
+
+  const auto subsetOf = [&](uint32_t i) -> uint32_t {
+    if (m.numSubsets == 2)
+      return (PARTITIONS2[partition] >> i) & 1;
+    else if (m.numSubsets == 3)
+      return (PARTITIONS3[partition] >> (2 * i)) & 3;
+    return 0;
+  };
+  const auto isAnchor = [&](uint32_t i) {
+    if (i == 0)
+      return true;
+    if (m.numSubsets == 2)
+      return i == ANCHORS2[partition];
+    if (m.numSubsets == 3)
+      return i == ANCHORS3_1[partition] || i == ANCHORS3_2[partition];
+    return false;
+  };
+
+  uint32_t indices[16];
+  uint32_t secondaryIndices[16];
+  for (uint32_t i = 0; i < 16; i++)
+    indices[i] = bits.read(m.indexBits - (isAnchor(i) ? 1 : 0));
+  for (uint32_t i = 0; i < 16; i++) {
+    secondaryIndices[i] = m.secondaryIndexBits
+        ? bits.read(m.secondaryIndexBits - (i == 0 ? 1 : 0))
+        : indices[i];
+  }
+
+  for (uint32_t i = 0; i < 16; i++) {
+    const uint32_t s = subsetOf(i);
+    const auto &e0 = endpoints[2 * s];
+    const auto &e1 = endpoints[2 * s + 1];
+
+    uint32_t colorIndex = indices[i];
+    uint32_t colorIndexBits = m.indexBits;
+    uint32_t alphaIndex = secondaryIndices[i];
+    uint32_t alphaIndexBits =
+        m.secondaryIndexBits ? m.secondaryIndexBits : m.indexBits;
+    if (indexSelection) {
+      std::swap(colorIndex, alphaIndex);
+      std::swap(colorIndexBits, alphaIndexBits);
+    }
+
+    const uint32_t wc = weightsForBits(colorIndexBits)[colorIndex];
+    const uint32_t wa = weightsForBits(alphaIndexBits)[alphaIndex];
+    float4 texel(float(interpolate(e0[0], e1[0], wc)),
+        float(interpolate(e0[1], e1[1], wc)),
+        float(interpolate(e0[2], e1[2], wc)),
+        float(interpolate(e0[3], e1[3], wa)));
+
+    if (rotation == 1)
+      std::swap(texel.x, texel.w);
+    else if (rotation == 2)
+      std::swap(texel.y, texel.w);
+    else if (rotation == 3)
+      std::swap(texel.z, texel.w);
+
+    out[i] = texel / 255.f;
+  }
+}
+
+// BC6H ///////////////////////////////////////////////////////////////////////
+
+// Header fields name one of the 4 endpoints (w, x, y, z) times 3 channels, or
+// the partition
+enum BC6HField : uint8_t
+{
+  RW,
+  GW,
+  BW,
+  RX,
+  GX,
+  BX,
+  RY,
+  GY,
+  BY,
+  RZ,
+  GZ,
+  BZ,
+  D
+};
+
+// 'count' bits of the stream land at bit 'lsb' of 'field'
+struct BC6HBits
+{
+  uint8_t field;
+  uint8_t lsb;
+  uint8_t count;
+};
+
+struct BC6HMode
+{
+  uint8_t modeBits;
+  bool transformed;
+  uint8_t endpointBits;
+  uint8_t deltaBits[3];
+  uint8_t numRegions;
+  BC6HBits layout[24];
+};
+
+constexpr BC6HMode BC6H_MODES[14] = {
+    {0x00, true, 10, {5, 5, 5}, 2,
+        {{GY, 4, 1}, {BY, 4, 1}, {BZ, 4, 1}, {RW, 0, 10}, {GW, 0, 10},
+            {BW, 0, 10}, {RX, 0, 5}, {GZ, 4, 1}, {GY, 0, 4}, {GX, 0, 5},
+            {BZ, 0, 1}, {GZ, 0, 4}, {BX, 0, 5}, {BZ, 1, 1}, {BY, 0, 4},
+            {RY, 0, 5}, {BZ, 2, 1}, {RZ, 0, 5}, {BZ, 3, 1}, {D, 0, 5}}},
+    {0x01, true, 7, {6, 6, 6}, 2,
+        {{GY, 5, 1}, {GZ, 4, 1}, {GZ, 5, 1}, {RW, 0, 7}, {BZ, 0, 1},
+            {BZ, 1, 1}, {BY, 4, 1}, {GW, 0, 7}, {BY, 5, 1}, {BZ, 2, 1},
+            {GY, 4, 1}, {BW, 0, 7}, {BZ, 3, 1}, {BZ, 5, 1}, {BZ, 4, 1},
+            {RX, 0, 6}, {GY, 0, 4}, {GX, 0, 6}, {GZ, 0, 4}, {BX, 0, 6},
+            {BY, 0, 4}, {RY, 0, 6}, {RZ, 0, 6}, {D, 0, 5}}},
+    {0x02, true, 11, {5, 4, 4}, 2,
+        {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 5}, {RW, 10, 1},
+            {GY, 0, 4}, {GX, 0, 4}, {GW, 10, 1}, {BZ, 0, 1}, {GZ, 0, 4},
+            {BX, 0, 4}, {BW, 10, 1}, {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 5},
+            {BZ, 2, 1}, {RZ, 0, 5}, {BZ, 3, 1}, {D, 0, 5}}},
+    {0x06, true, 11, {4, 5, 4}, 2,
+        {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 4}, {RW, 10, 1},
+            {GZ, 4, 1}, {GY, 0, 4}, {GX, 0, 5}, {GW, 10, 1}, {GZ, 0, 4},
+            {BX, 0, 4}, {BW, 10, 1}, {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 4},
+            {BZ, 0, 1}, {BZ, 2, 1}, {RZ, 0, 4}, {GY, 4, 1}, {BZ, 3, 1},
+            {D, 0, 5}}},
+    {0x0A, true, 11, {4, 4, 5}, 2,
+        {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 4}, {RW, 10, 1},
+            {BY, 4, 1}, {GY, 0, 4}, {GX, 0, 4}, {GW, 10, 1}, {BZ, 0, 1},
+            {GZ, 0, 4}, {BX, 0, 5}, {BW, 10, 1}, {BY, 0, 4}, {RY, 0, 4},
+            {BZ, 1, 1}, {BZ, 2, 1}, {RZ, 0, 4}, {BZ, 4, 1}, {BZ, 3, 1},
+            {D, 0, 5}}},
+    {0x0E, true, 9, {5, 5, 5}, 2,
+        {{RW, 0, 9}, {BY, 4, 1}, {GW, 0, 9}, {GY, 4, 1}, {BW, 0, 9},
+            {BZ, 4, 1}, {RX, 0, 5}, {GZ, 4, 1}, {GY, 0, 4}, {GX, 0, 5},
+            {BZ, 0, 1}, {GZ, 0, 4}, {BX, 0, 5}, {BZ, 1, 1}, {BY, 0, 4},
+            {RY, 0, 5}, {BZ, 2, 1}, {RZ, 0, 5}, {BZ, 3, 1}, {D, 0, 5}}},
+    {0x12, true, 8, {6, 5, 5}, 2,
+        {{RW, 0, 8}, {GZ, 4, 1}, {BY, 4, 1}, {GW, 0, 8}, {BZ, 2, 1},
+            {GY, 4, 1}, {BW, 0, 8}, {BZ, 3, 1}, {BZ, 4, 1}, {RX, 0, 6},
+            {GY, 0, 4}, {GX, 0, 5}, {BZ, 0, 1}, {GZ, 0, 4}, {BX, 0, 5},
+            {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 6}, {RZ, 0, 6}, {D, 0, 5}}},
+    {0x16, true, 8, {5, 6, 5}, 2,
+        {{RW, 0, 8}, {BZ, 0, 1}, {BY, 4, 1}, {GW, 0, 8}, {GY, 5, 1},
+            {GY, 4, 1}, {BW, 0, 8}, {GZ, 5, 1}, {BZ, 4, 1}, {RX, 0, 5},
+            {GZ, 4, 1}, {GY, 0, 4}, {GX, 0, 6}, {GZ, 0, 4}, {BX, 0, 5},
+            {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 5}, {BZ, 2, 1}, {RZ, 0, 5},
+            {BZ, 3, 1}, {D, 0, 5}}},
+    {0x1A, true, 8, {5, 5, 6}, 2,
+        {{RW, 0, 8}, {BZ, 1, 1}, {BY, 4, 1}, {GW, 0, 8}, {BY, 5, 1},
+            {GY, 4, 1}, {BW, 0, 8}, {BZ, 5, 1}, {BZ, 4, 1}, {RX, 0, 5},
+            {GZ, 4, 1}, {GY, 0, 4}, {GX, 0, 5}, {BZ, 0, 1}, {GZ, 0, 4},
+            {BX, 0, 6}, {BY, 0, 4}, {RY, 0, 5}, {BZ, 2, 1}, {RZ, 0, 5},
+            {BZ, 3, 1}, {D, 0, 5}}},
+    {0x1E, false, 6, {6, 6, 6}, 2,
+        {{RW, 0, 6}, {GZ, 4, 1}, {BZ, 0, 1}, {BZ, 1, 1}, {BY, 4, 1},
+            {GW, 0, 6}, {GY, 5, 1}, {BY, 5, 1}, {BZ, 2, 1}, {GY, 4, 1},
+            {BW, 0, 6}, {GZ, 5, 1}, {BZ, 3, 1}, {BZ, 5, 1}, {BZ, 4, 1},
+            {RX, 0, 6}, {GY, 0, 4}, {GX, 0, 6}, {GZ, 0, 4}, {BX, 0, 6},
+            {BY, 0, 4}, {RY, 0, 6}, {RZ, 0, 6}, {D, 0, 5}}},
+    {0x03, false, 10, {10, 10, 10}, 1,
+        {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 10}, {GX, 0, 10},
+            {BX, 0, 10}}},
+    {0x07, true, 11, {9, 9, 9}, 1,
+        {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 9}, {RW, 10, 1},
+            {GX, 0, 9}, {GW, 10, 1}, {BX, 0, 9}, {BW, 10, 1}}},
+    // the high endpoint bits of the last two modes are stored reversed
+    {0x0B, true, 12, {8, 8, 8}, 1,
+        {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 8}, {RW, 11, 1},
+            {RW, 10, 1}, {GX, 0, 8}, {GW, 11, 1}, {GW, 10, 1}, {BX, 0, 8},
+            {BW, 11, 1}, {BW, 10, 1}}},
+    {0x0F, true, 16, {4, 4, 4}, 1,
+        {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 4}, {RW, 15, 1},
+            {RW, 14, 1}, {RW, 13, 1}, {RW, 12, 1}, {RW, 11, 1}, {RW, 10, 1},
+            {GX, 0, 4}, {GW, 15, 1}, {GW, 14, 1}, {GW, 13, 1}, {GW, 12, 1},
+            {GW, 11, 1}, {GW, 10, 1}, {BX, 0, 4}, {BW, 15, 1}, {BW, 14, 1},
+            {BW, 13, 1}, {BW, 12, 1}, {BW, 11, 1}, {BW, 10, 1}}}};
+
+int32_t unquantizeBC6H(int32_t v, uint32_t bits, bool isSigned)
+{
+  if (!isSigned) {
+    if (bits >= 15)
+      return v;
+    if (v == 0)
+      return 0;
+    if (v == (1 << bits) - 1)
+      return 0xFFFF;
+    return ((v << 16) + 0x8000) >> bits;
+  }
+
+  if (bits >= 16)
+    return v;
+  const bool negative = v < 0;
+  if (negative)
+    v = -v;
+  int32_t q = 0;
+  if (v == 0)
+    q = 0;
+  else if (v >= (1 << (bits - 1)) - 1)
+    q = 0x7FFF;
+  else
+    q = ((v << 15) + 0x4000) >> (bits - 1);
+  return negative ? -q : q;
+}
+
+float finishUnquantizeBC6H(int32_t v, bool isSigned)
+{
+  if (!isSigned)
+    return halfToFloat(uint16_t((v * 31) >> 6));
+  const uint16_t h = v < 0 ? uint16_t(0x8000 | ((-v * 31) >> 5))
+                           : uint16_t((v * 31) >> 5);
+  return halfToFloat(h);
+}
+
+void decodeBC6H(const uint8_t *block, bool isSigned, float4 *out)
+{
+  BlockBits bits(block);
+
+  uint32_t modeBits = bits.read(2);
+  if (modeBits > 1)
+    modeBits |= bits.read(3) << 2;
+
+  const auto *m = std::find_if(std::begin(BC6H_MODES),
+      std::end(BC6H_MODES),
+      [&](const BC6HMode &mode) { return mode.modeBits == modeBits; });
+  if (m == std::end(BC6H_MODES)) {
+    // reserved mode
+    std::fill(out, out + 16, float4(0.f, 0.f, 0.f, 1.f));
+    return;
+  }
+
+  int32_t e[12] = {};
+  uint32_t partition = 0;
+  for (const auto &f : m->layout) {
+    if (f.count == 0)
+      break;
+    const uint32_t v = bits.read(f.count);
+    if (f.field == D)
+      partition |= v << f.lsb;
+    else
+      e[f.field] |= int32_t(v << f.lsb);
+  }
+
+  // endpoints after the first are deltas in transformed modes
+  const uint32_t numEndpoints = 2u * m->numRegions;
+  const uint32_t epBits = m->endpointBits;
+  for (uint32_t c = 0; c < 3; c++) {
+    if (isSigned)
+      e[c] = signExtend(e[c], epBits);
+    for (uint32_t ep = 1; ep < numEndpoints; ep++) {
+      auto &v = e[3 * ep + c];
+      if (m->transformed) {
+        v = signExtend(v, m->deltaBits[c]);
+        v = (e[c] + v) & ((1 << epBits) - 1);
+      }
+      if (isSigned)
+        v = signExtend(v, epBits);
+    }
+  }
+
+  for (uint32_t i = 0; i < 3 * numEndpoints; i++)
+    e[i] = unquantizeBC6H(e[i], epBits, isSigned);
+
+  const uint32_t indexBits = m->numRegions == 2 ? 3 : 4;
+  const uint8_t *weights = weightsForBits(indexBits);
+  for (uint32_t i = 0; i < 16; i++) {
+    const bool anchor =
+        i == 0 || (m->numRegions == 2 && i == ANCHORS2[partition]);
+    const uint32_t index = bits.read(indexBits - (anchor ? 1 : 0));
+    const uint32_t s =
+        m->numRegions == 2 ? (PARTITIONS2[partition] >> i) & 1 : 0;
+
+    float rgb[3];
+    for (uint32_t c = 0; c < 3; c++) {
+      const int32_t v = interpolate(
+          e[3 * (2 * s) + c], e[3 * (2 * s + 1) + c], weights[index]);
+      rgb[c] = finishUnquantizeBC6H(v, isSigned);
+    }
+    out[i] = float4(rgb[0], rgb[1], rgb[2], 1.f);
+  }
+}
+
+} // namespace
+
+// Function definitions ///////////////////////////////////////////////////////
+
+CompressedFormat compressedFormatFromString(const std::string &str)
+{
+  CompressedFormat f;
+  if (str == "BC1_RGB" || str == "BC1_RGB_SRGB")
+    f.format = BlockFormat::BC1_RGB;
+  else if (str == "BC1_RGBA" || str == "BC1_RGBA_SRGB")
+    f.format = BlockFormat::BC1_RGBA;
+  else if (str == "BC2" || str == "BC2_SRGB")
+    f.format = BlockFormat::BC2;
+  else if (str == "BC3" || str == "BC3_SRGB")
+    f.format = BlockFormat::BC3;
+  else if (str == "BC4")
+    f.format = BlockFormat::BC4;
+  else if (str == "BC4_SNORM")
+    f.format = BlockFormat::BC4_SNORM;
+  else if (str == "BC5")
+    f.format = BlockFormat::BC5;
+  else if (str == "BC5_SNORM")
+    f.format = BlockFormat::BC5_SNORM;
+  else if (str == "BC6H_UFLOAT")
+    f.format = BlockFormat::BC6H_UFLOAT;
+  else if (str == "BC6H_SFLOAT")
+    f.format = BlockFormat::BC6H_SFLOAT;
+  else if (str == "BC7" || str == "BC7_SRGB")
+    f.format = BlockFormat::BC7;
+
+  f.srgb = str.size() > 5 && str.compare(str.size() - 5, 5, "_SRGB") == 0;
+  return f;
+}
+
+size_t blockSizeInBytes(BlockFormat format)
+{
+  switch (format) {
+  case BlockFormat::BC1_RGB:
+  case BlockFormat::BC1_RGBA:
+  case BlockFormat::BC4:
+  case BlockFormat::BC4_SNORM:
+    return 8;
+  case BlockFormat::UNKNOWN:
+    return 0;
+  default:
+    return 16;
+  }
+}
+
+void decodeBlock(
+    const CompressedFormat &format, const uint8_t *block, float4 texels[16])
+{
+  float channel[16];
+
+  switch (format.format) {
+  case BlockFormat::BC1_RGB:
+    decodeColorBlock(block, true, false, texels);
+    break;
+  case BlockFormat::BC1_RGBA:
+    decodeColorBlock(block, true, true, texels);
+    break;
+  case BlockFormat::BC2: {
+    decodeColorBlock(block + 8, false, false, texels);
+    const uint64_t alpha = readLE(block, 8);
+    for (int i = 0; i < 16; i++)
+      texels[i].w = ((alpha >> (4 * i)) & 0xf) / 15.f;
+    break;
+  }
+  case BlockFormat::BC3:
+    decodeColorBlock(block + 8, false, false, texels);
+    decodeChannelBlock(block, false, channel);
+    for (int i = 0; i < 16; i++)
+      texels[i].w = channel[i];
+    break;
+  case BlockFormat::BC4:
+  case BlockFormat::BC4_SNORM:
+    decodeChannelBlock(block, format.format == BlockFormat::BC4_SNORM, channel);
+    for (int i = 0; i < 16; i++)
+      texels[i] = float4(channel[i], 0.f, 0.f, 1.f);
+    break;
+  case BlockFormat::BC5:
+  case BlockFormat::BC5_SNORM: {
+    const bool snorm = format.format == BlockFormat::BC5_SNORM;
+    decodeChannelBlock(block, snorm, channel);
+    for (int i = 0; i < 16; i++)
+      texels[i] = float4(channel[i], 0.f, 0.f, 1.f);
+    decodeChannelBlock(block + 8, snorm, channel);
+    for (int i = 0; i < 16; i++)
+      texels[i].y = channel[i];
+    break;
+  }
+  case BlockFormat::BC6H_UFLOAT:
+  case BlockFormat::BC6H_SFLOAT:
+    decodeBC6H(block, format.format == BlockFormat::BC6H_SFLOAT, texels);
+    break;
+  case BlockFormat::BC7:
+    decodeBC7(block, texels);
+    break;
+  default:
+    std::fill(texels, texels + 16, float4(0.f, 0.f, 0.f, 1.f));
+    return;
+  }
+
+  // same sRGB treatment as the uncompressed *_SRGB array element types
+  if (format.srgb) {
+    for (int i = 0; i < 16; i++) {
+      auto &t = texels[i];
+      t = float4(toneMap(t.x), toneMap(t.y), toneMap(t.z), t.w);
+    }
+  }
+}
+
+} // namespace helide
@@ -0,0 +1,47 @@
+// Copyright 2022-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "HelideMath.h"
+// std
+#include <string>
+
+namespace helide {
+
+// Block-compressed texel formats of the compressedImage2D sampler, each block
+// covering 4x4 texels
+
+enum class BlockFormat
+{
+  BC1_RGB,
+  BC1_RGBA,
+  BC2,
+  BC3,
+  BC4,
+  BC4_SNORM,
+  BC5,
+  BC5_SNORM,
+  BC6H_UFLOAT,
+  BC6H_SFLOAT,
+  BC7,
+  UNKNOWN
+};
+
+struct CompressedFormat
+{
+  BlockFormat format{BlockFormat::UNKNOWN};
+  bool srgb{false}; // applies to the color channels of BC1-3 and BC7 only
+};
+
+CompressedFormat compressedFormatFromString(const std::string &str);
+
+// Size of one encoded block: 8 bytes for BC1 and BC4, 16 bytes otherwise
+size_t blockSizeInBytes(BlockFormat format);
+
+// Decodes all 16 texels of 'block' in row-major order, channels missing from
+// the format read as 0 (color) and 1 (alpha)
+void decodeBlock(
+    const CompressedFormat &format, const uint8_t *block, float4 texels[16]);
+
+} // namespace helide
@@ -0,0 +1,150 @@
+// Copyright 2022-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CompressedImage2D.h"
+#include "scene/surface/geometry/Geometry.h"
+// std
+#include <array>
+
+namespace helide {
+
+// Helper types ///////////////////////////////////////////////////////////////
+
+namespace {
+
+// Blocks are decoded on first touch into a small per-thread cache, slotted by
+// the low bits of the block coordinates so that a 32x32 texel neighborhood
+// stays resident while a tile is rendered
+struct DecodedBlock
+{
+  helium::TimeStamp key{0};
+  uint32_t block{0};
+  float4 texels[16];
+};
+
+constexpr uint32_t BLOCK_CACHE_SHIFT = 3;
+constexpr uint32_t BLOCK_CACHE_MASK = (1u << BLOCK_CACHE_SHIFT) - 1;
+
+thread_local std::array<DecodedBlock, 1u << (2 * BLOCK_CACHE_SHIFT)>
+    t_blockCache;
+
+} // namespace
+
+// CompressedImage2D definitions //////////////////////////////////////////////
+
+CompressedImage2D::CompressedImage2D(HelideGlobalState *s)
+    : Sampler(s), m_image(this)
+{}
+
+bool CompressedImage2D::isValid() const
+{
+  return Sampler::isValid() && m_blocks;
+}
+
+void CompressedImage2D::commit()
+{
+  Sampler::commit();
+  m_image = getParamObject<Array1D>("image");
+  m_format = compressedFormatFromString(getParamString("format", ""));
+  m_inAttribute =
+      attributeFromString(getParamString("inAttribute", "attribute0"));
+  m_linearFilter = getParamString("filter", "nearest") == "linear";
+  m_wrapMode1 = wrapModeFromString(getParamString("wrapMode1", "clampToEdge"));
+  m_wrapMode2 = wrapModeFromString(getParamString("wrapMode2", "clampToEdge"));
+  m_inTransform = getParam<mat4>("inTransform", mat4(linalg::identity));
+  m_inOffset = getParam<float4>("inOffset", float4(0.f, 0.f, 0.f, 0.f));
+  m_outTransform = getParam<mat4>("outTransform", mat4(linalg::identity));
+  m_outOffset = getParam<float4>("outOffset", float4(0.f, 0.f, 0.f, 0.f));
+
+  uint64_t size[2] = {0, 0};
+  getParam("size", ANARI_UINT64_VEC2, size);
+  m_size = uint2(uint32_t(size[0]), uint32_t(size[1]));
+
+  m_blocks = nullptr;
+  m_cacheKey = helium::newTimeStamp();
+
+  if (!m_image) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameter 'image' on compressedImage2D sampler");
+    return;
+  }
+
+  if (m_format.format == BlockFormat::UNKNOWN) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unknown 'format' (%s) on compressedImage2D sampler",
+        getParamString("format", "").c_str());
+    return;
+  }
+
+  if (m_size.x == 0 || m_size.y == 0) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "missing required parameter 'size' on compressedImage2D sampler");
+    return;
+  }
+
+  m_blockBytes = blockSizeInBytes(m_format.format);
+  m_blocksPerRow = (m_size.x + 3) / 4;
+  const size_t requiredBytes =
+      m_blockBytes * m_blocksPerRow * ((m_size.y + 3) / 4);
+  const size_t imageBytes =
+      m_image->size() * anari::sizeOf(m_image->elementType());
+  if (imageBytes < requiredBytes) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "compressedImage2D 'image' holds %zu bytes, %zu are needed for a"
+        " %ux%u image",
+        imageBytes,
+        requiredBytes,
+        m_size.x,
+        m_size.y);
+    return;
+  }
+
+  m_blocks = (const uint8_t *)m_image->begin();
+}
+
+float4 CompressedImage2D::getSample(const Geometry &g, const Ray &r) const
+{
+  if (m_inAttribute == Attribute::NONE)
+    return DEFAULT_ATTRIBUTE_VALUE;
+
+  auto av = linalg::mul(m_inTransform, g.getAttributeValue(m_inAttribute, r))
+      + m_inOffset;
+
+  const auto ix = getInterpolant(av.x, m_size.x, true);
+  const auto iy = getInterpolant(av.y, m_size.y, true);
+
+  const uint32_t x0 = calculateWrapIndex(ix.lower, m_size.x, m_wrapMode1);
+  const uint32_t x1 = calculateWrapIndex(ix.upper, m_size.x, m_wrapMode1);
+  const uint32_t y0 = calculateWrapIndex(iy.lower, m_size.y, m_wrapMode2);
+  const uint32_t y1 = calculateWrapIndex(iy.upper, m_size.y, m_wrapMode2);
+
+  float4 retval;
+  if (m_linearFilter) {
+    const auto v0 = linalg::lerp(texelAt(x0, y0), texelAt(x0, y1), iy.frac);
+    const auto v1 = linalg::lerp(texelAt(x1, y0), texelAt(x1, y1), iy.frac);
+    retval = linalg::lerp(v0, v1, ix.frac);
+  } else {
+    retval = texelAt(ix.frac < 0.5f ? x0 : x1, iy.frac < 0.5f ? y0 : y1);
+  }
+
+  return linalg::mul(m_outTransform, retval) + m_outOffset;
+}
+
+float4 CompressedImage2D::texelAt(uint32_t x, uint32_t y) const
+{
+  const uint32_t bx = x >> 2;
+  const uint32_t by = y >> 2;
+  const uint32_t block = bx + m_blocksPerRow * by;
+
+  auto &entry = t_blockCache[(bx & BLOCK_CACHE_MASK)
+      | ((by & BLOCK_CACHE_MASK) << BLOCK_CACHE_SHIFT)];
+  if (entry.key != m_cacheKey || entry.block != block) {
+    decodeBlock(m_format, m_blocks + block * m_blockBytes, entry.texels);
+    entry.key = m_cacheKey;
+    entry.block = block;
+  }
+
+  return entry.texels[(x & 3) + 4 * (y & 3)];
+}
+
+} // namespace helide
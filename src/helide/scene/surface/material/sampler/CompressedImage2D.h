@@ -0,0 +1,41 @@
+// Copyright 2022-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "BlockCompression.h"
+#include "Sampler.h"
+#include "array/Array1D.h"
+
+namespace helide {
+
+struct CompressedImage2D : public Sampler
+{
+  CompressedImage2D(HelideGlobalState *d);
+
+  bool isValid() const override;
+  void commit() override;
+
+  float4 getSample(const Geometry &g, const Ray &r) const override;
+
+ private:
+  float4 texelAt(uint32_t x, uint32_t y) const;
+
+  helium::ChangeObserverPtr<Array1D> m_image;
+  CompressedFormat m_format;
+  uint2 m_size{0u, 0u};
+  uint32_t m_blocksPerRow{0};
+  size_t m_blockBytes{0};
+  const uint8_t *m_blocks{nullptr};
+  helium::TimeStamp m_cacheKey{0}; // identifies this commit's decoded blocks
+  Attribute m_inAttribute{Attribute::NONE};
+  WrapMode m_wrapMode1{WrapMode::DEFAULT};
+  WrapMode m_wrapMode2{WrapMode::DEFAULT};
+  bool m_linearFilter{false};
+  mat4 m_inTransform{mat4(linalg::identity)};
+  float4 m_inOffset{0.f, 0.f, 0.f, 0.f};
+  mat4 m_outTransform{mat4(linalg::identity)};
+  float4 m_outOffset{0.f, 0.f, 0.f, 0.f};
+};
+
+} // namespace helide
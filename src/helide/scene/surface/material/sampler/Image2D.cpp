@@ -6,7 +6,7 @@
 
 namespace helide {
 
-Image2D::Image2D(HelideGlobalState *s) : Sampler(s) {}
+Image2D::Image2D(HelideGlobalState *s) : Sampler(s), m_image(this) {}
 
 bool Image2D::isValid() const
 {
@@ -19,13 +19,29 @@ void Image2D::commit()
   m_image = getParamObject<Array2D>("image");
   m_inAttribute =
       attributeFromString(getParamString("inAttribute", "attribute0"));
-  m_linearFilter = getParamString("filter", "linear") != "nearest";
+  const auto filter = getParamString("filter", "linear");
+  m_linearFilter = filter != "nearest";
+  m_trilinearFilter = filter == "trilinear";
   m_wrapMode1 = wrapModeFromString(getParamString("wrapMode1", "clampToEdge"));
   m_wrapMode2 = wrapModeFromString(getParamString("wrapMode2", "clampToEdge"));
   m_inTransform = getParam<mat4>("inTransform", mat4(linalg::identity));
   m_inOffset = getParam<float4>("inOffset", float4(0.f, 0.f, 0.f, 0.f));
   m_outTransform = getParam<mat4>("outTransform", mat4(linalg::identity));
   m_outOffset = getParam<float4>("outOffset", float4(0.f, 0.f, 0.f, 0.f));
+
+  m_texels.clear();
+  if (!m_image)
+    return;
+
+  // every filter reads a copy converted once to RGBA8 or float4, so sampling
+  // never switches on the element type; only 'trilinear' needs mip levels
+  const auto *data = m_image->data();
+  const auto type = m_image->elementType();
+  const auto size = m_image->size();
+  const bool rgba8 = MipChain::storesAsRGBA8(type);
+  m_texels.build(uint3(size, 1), rgba8, m_trilinearFilter, [&](const uint3 &i) {
+    return readAsAttributeValueFlat(data, type, i.x + size_t(size.x) * i.y);
+  });
 }
 
 float4 Image2D::getSample(const Geometry &g, const Ray &r) const
@@ -36,24 +52,16 @@ float4 Image2D::getSample(const Geometry &g, const Ray &r) const
   auto av = linalg::mul(m_inTransform, g.getAttributeValue(m_inAttribute, r))
       + m_inOffset;
 
-  const auto interp_x = getInterpolant(av.x, m_image->size().x, true);
-  const auto interp_y = getInterpolant(av.y, m_image->size().y, true);
-  const auto v00 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.lower}, m_wrapMode1, m_wrapMode2);
-  const auto v01 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.upper}, m_wrapMode1, m_wrapMode2);
-  const auto v10 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.lower}, m_wrapMode1, m_wrapMode2);
-  const auto v11 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.upper}, m_wrapMode1, m_wrapMode2);
-
-  const auto v0 = m_linearFilter ? linalg::lerp(v00, v01, interp_y.frac)
-                                 : (interp_y.frac < 0.5f ? v00 : v01);
-  const auto v1 = m_linearFilter ? linalg::lerp(v10, v11, interp_y.frac)
-                                 : (interp_y.frac < 0.5f ? v10 : v11);
-
-  const auto retval = m_linearFilter ? linalg::lerp(v0, v1, interp_x.frac)
-                                     : (interp_x.frac < 0.5f ? v0 : v1);
+  const WrapMode wrap[3] = {m_wrapMode1, m_wrapMode2, WrapMode::DEFAULT};
+  const float3 coord(av.x, av.y, 0.f);
+
+  float4 retval;
+  if (m_trilinearFilter) {
+    const float lod = textureLod(
+        g, m_inAttribute, m_inTransform, r, uint3(m_image->size(), 1));
+    retval = m_texels.sampleLod(lod, coord, wrap);
+  } else
+    retval = m_texels.sample(0, coord, m_linearFilter, wrap);
 
   return linalg::mul(m_outTransform, retval) + m_outOffset;
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "MipChain.h"
 #include "Sampler.h"
 #include "array/Array2D.h"
 
@@ -18,15 +19,17 @@ struct Image2D : public Sampler
   float4 getSample(const Geometry &g, const Ray &r) const override;
 
  private:
-  helium::IntrusivePtr<Array2D> m_image;
+  helium::ChangeObserverPtr<Array2D> m_image;
   Attribute m_inAttribute{Attribute::NONE};
   WrapMode m_wrapMode1{WrapMode::DEFAULT};
   WrapMode m_wrapMode2{WrapMode::DEFAULT};
   bool m_linearFilter{true};
+  bool m_trilinearFilter{false};
   mat4 m_inTransform{mat4(linalg::identity)};
   float4 m_inOffset{0.f, 0.f, 0.f, 0.f};
   mat4 m_outTransform{mat4(linalg::identity)};
   float4 m_outOffset{0.f, 0.f, 0.f, 0.f};
+  MipChain m_texels;
 };
 
 } // namespace helide
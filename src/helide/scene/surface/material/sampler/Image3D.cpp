@@ -6,7 +6,7 @@
 
 namespace helide {
 
-Image3D::Image3D(HelideGlobalState *s) : Sampler(s) {}
+Image3D::Image3D(HelideGlobalState *s) : Sampler(s), m_image(this) {}
 
 bool Image3D::isValid() const
 {
@@ -19,12 +19,29 @@ void Image3D::commit()
   m_image = getParamObject<Array3D>("image");
   m_inAttribute =
       attributeFromString(getParamString("inAttribute", "attribute0"));
-  m_linearFilter = getParamString("filter", "linear") != "nearest";
+  const auto filter = getParamString("filter", "linear");
+  m_linearFilter = filter != "nearest";
+  m_trilinearFilter = filter == "trilinear";
   m_wrapMode1 = wrapModeFromString(getParamString("wrapMode1", "clampToEdge"));
   m_wrapMode2 = wrapModeFromString(getParamString("wrapMode2", "clampToEdge"));
   m_wrapMode3 = wrapModeFromString(getParamString("wrapMode3", "clampToEdge"));
   m_inTransform = getParam<mat4>("inTransform", mat4(linalg::identity));
   m_outTransform = getParam<mat4>("outTransform", mat4(linalg::identity));
+
+  m_texels.clear();
+  if (!m_image)
+    return;
+
+  // every filter reads a copy converted once to RGBA8 or float4, so sampling
+  // never switches on the element type; only 'trilinear' needs mip levels
+  const auto *data = m_image->data();
+  const auto type = m_image->elementType();
+  const auto size = m_image->size();
+  const bool rgba8 = MipChain::storesAsRGBA8(type);
+  m_texels.build(size, rgba8, m_trilinearFilter, [&](const uint3 &i) {
+    const size_t idx = i.x + size.x * (i.y + size_t(size.y) * i.z);
+    return readAsAttributeValueFlat(data, type, idx);
+  });
 }
 
 float4 Image3D::getSample(const Geometry &g, const Ray &r) const
@@ -35,67 +52,16 @@ float4 Image3D::getSample(const Geometry &g, const Ray &r) const
   auto av = linalg::mul(m_inTransform, g.getAttributeValue(m_inAttribute, r))
       + m_inOffset;
 
-  const auto interp_x = getInterpolant(av.x, m_image->size().x, true);
-  const auto interp_y = getInterpolant(av.y, m_image->size().y, true);
-  const auto interp_z = getInterpolant(av.z, m_image->size().z, true);
-
-  const auto v000 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.lower, interp_z.lower},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v001 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.lower, interp_z.upper},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v010 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.upper, interp_z.lower},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v011 = m_image->readAsAttributeValue(
-      {interp_x.lower, interp_y.upper, interp_z.upper},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v100 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.lower, interp_z.lower},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v101 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.lower, interp_z.upper},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v110 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.upper, interp_z.lower},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-  const auto v111 = m_image->readAsAttributeValue(
-      {interp_x.upper, interp_y.upper, interp_z.upper},
-      m_wrapMode1,
-      m_wrapMode2,
-      m_wrapMode3);
-
-  const auto v00 = m_linearFilter ? linalg::lerp(v000, v001, interp_z.frac)
-                                  : (interp_z.frac < 0.5f ? v000 : v001);
-  const auto v01 = m_linearFilter ? linalg::lerp(v010, v011, interp_z.frac)
-                                  : (interp_z.frac < 0.5f ? v010 : v011);
-  const auto v10 = m_linearFilter ? linalg::lerp(v100, v101, interp_z.frac)
-                                  : (interp_z.frac < 0.5f ? v100 : v101);
-  const auto v11 = m_linearFilter ? linalg::lerp(v110, v111, interp_z.frac)
-                                  : (interp_z.frac < 0.5f ? v110 : v111);
-
-  const auto v0 = m_linearFilter ? linalg::lerp(v00, v01, interp_y.frac)
-                                 : (interp_y.frac < 0.5f ? v00 : v01);
-  const auto v1 = m_linearFilter ? linalg::lerp(v10, v11, interp_y.frac)
-                                 : (interp_y.frac < 0.5f ? v10 : v11);
+  const WrapMode wrap[3] = {m_wrapMode1, m_wrapMode2, m_wrapMode3};
+  const float3 coord(av.x, av.y, av.z);
 
-  const auto retval = m_linearFilter ? linalg::lerp(v0, v1, interp_x.frac)
-                                     : (interp_x.frac < 0.5f ? v0 : v1);
+  float4 retval;
+  if (m_trilinearFilter) {
+    const float lod =
+        textureLod(g, m_inAttribute, m_inTransform, r, m_image->size());
+    retval = m_texels.sampleLod(lod, coord, wrap);
+  } else
+    retval = m_texels.sample(0, coord, m_linearFilter, wrap);
 
   return linalg::mul(m_outTransform, retval) + m_outOffset;
 }
@@ -0,0 +1,159 @@
+// Copyright 2022-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "MipChain.h"
+// std
+#include <algorithm>
+#include <cmath>
+
+namespace helide {
+
+// MipLevel definitions ///////////////////////////////////////////////////////
+
+MipLevel::MipLevel(const uint3 &size, bool rgba8) : m_size(size)
+{
+  constexpr uint32_t S = MipChain::TILE_SHIFT;
+  m_tileShiftZ = size.z > 1 ? S : 0;
+  m_tiles = uint3((size.x + (1u << S) - 1) >> S,
+      (size.y + (1u << S) - 1) >> S,
+      (size.z + (1u << m_tileShiftZ) - 1) >> m_tileShiftZ);
+  const size_t numTexels = size_t(m_tiles.x) * m_tiles.y * m_tiles.z
+      << (2 * S + m_tileShiftZ);
+  if (rgba8)
+    m_texelsRGBA8.resize(numTexels);
+  else
+    m_texels.resize(numTexels);
+}
+
+// MipChain definitions ///////////////////////////////////////////////////////
+
+bool MipChain::storesAsRGBA8(ANARIDataType type)
+{
+  // sRGB sources are linearized on conversion and need more than 8 bits
+  return type == ANARI_UFIXED8 || type == ANARI_UFIXED8_VEC2
+      || type == ANARI_UFIXED8_VEC3 || type == ANARI_UFIXED8_VEC4;
+}
+
+void MipChain::clear()
+{
+  m_levels.clear();
+}
+
+bool MipChain::empty() const
+{
+  return m_levels.empty();
+}
+
+uint32_t MipChain::numLevels() const
+{
+  return uint32_t(m_levels.size());
+}
+
+const MipLevel &MipChain::level(uint32_t l) const
+{
+  return m_levels[l];
+}
+
+size_t MipChain::memoryUsed() const
+{
+  size_t bytes = 0;
+  for (auto &l : m_levels) {
+    const auto s = l.size();
+    const size_t texelBytes = l.rgba8() ? sizeof(uint32_t) : sizeof(float4);
+    bytes += size_t(s.x) * s.y * s.z * texelBytes;
+  }
+  return bytes;
+}
+
+float4 MipChain::sample(uint32_t l,
+    const float3 &coord,
+    bool linear,
+    const WrapMode wrap[3]) const
+{
+  const auto &level = m_levels[l];
+  const auto size = level.size();
+
+  const auto ix = getInterpolant(coord.x, size.x, true);
+  const auto iy = getInterpolant(coord.y, size.y, true);
+  const auto iz = getInterpolant(coord.z, size.z, true);
+
+  const uint32_t x0 = calculateWrapIndex(ix.lower, size.x, wrap[0]);
+  const uint32_t x1 = calculateWrapIndex(ix.upper, size.x, wrap[0]);
+  const uint32_t y0 = calculateWrapIndex(iy.lower, size.y, wrap[1]);
+  const uint32_t y1 = calculateWrapIndex(iy.upper, size.y, wrap[1]);
+
+  if (!linear) {
+    const uint32_t x = ix.frac < 0.5f ? x0 : x1;
+    const uint32_t y = iy.frac < 0.5f ? y0 : y1;
+    uint32_t z = 0;
+    if (size.z > 1) {
+      z = calculateWrapIndex(
+          iz.frac < 0.5f ? iz.lower : iz.upper, size.z, wrap[2]);
+    }
+    return level.at(uint3(x, y, z));
+  }
+
+  const auto bilinear = [&](uint32_t z) {
+    const auto v0 = linalg::lerp(
+        level.at(uint3(x0, y0, z)), level.at(uint3(x0, y1, z)), iy.frac);
+    const auto v1 = linalg::lerp(
+        level.at(uint3(x1, y0, z)), level.at(uint3(x1, y1, z)), iy.frac);
+    return linalg::lerp(v0, v1, ix.frac);
+  };
+
+  if (size.z == 1)
+    return bilinear(0);
+
+  const uint32_t z0 = calculateWrapIndex(iz.lower, size.z, wrap[2]);
+  const uint32_t z1 = calculateWrapIndex(iz.upper, size.z, wrap[2]);
+  return linalg::lerp(bilinear(z0), bilinear(z1), iz.frac);
+}
+
+float4 MipChain::sampleLod(
+    float lod, const float3 &coord, const WrapMode wrap[3]) const
+{
+  const float maxLevel = float(m_levels.size() - 1);
+  lod = std::clamp(lod, 0.f, maxLevel);
+  const auto l0 = uint32_t(lod);
+  const float frac = lod - l0;
+  const auto v0 = sample(l0, coord, true, wrap);
+  if (frac == 0.f)
+    return v0;
+  return linalg::lerp(v0, sample(l0 + 1, coord, true, wrap), frac);
+}
+
+void MipChain::buildMipLevels()
+{
+  while (true) {
+    const auto &prev = m_levels.back();
+    const auto ps = prev.size();
+    if (ps.x == 1 && ps.y == 1 && ps.z == 1)
+      break;
+
+    const uint3 size(std::max(ps.x / 2, 1u),
+        std::max(ps.y / 2, 1u),
+        std::max(ps.z / 2, 1u));
+    MipLevel next(size, prev.rgba8());
+
+    // box filter over the 2x2(x2) parents, clamped where an odd dimension
+    // leaves a texel without a partner
+    embree::parallel_for(size_t(size.y) * size.z, [&](size_t row) {
+      const auto y = uint32_t(row % size.y);
+      const auto z = uint32_t(row / size.y);
+      for (uint32_t x = 0; x < size.x; x++) {
+        float4 sum(0.f);
+        for (uint32_t k = 0; k < 8; k++) {
+          const uint3 p(std::min(2 * x + (k & 1), ps.x - 1),
+              std::min(2 * y + ((k >> 1) & 1), ps.y - 1),
+              std::min(2 * z + (k >> 2), ps.z - 1));
+          sum += prev.at(p);
+        }
+        next.set(uint3(x, y, z), sum * 0.125f);
+      }
+    });
+
+    m_levels.push_back(std::move(next));
+  }
+}
+
+} // namespace helide
@@ -0,0 +1,141 @@
+// Copyright 2022-2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "HelideMath.h"
+// embree
+#include "algorithms/parallel_for.h"
+// std
+#include <vector>
+
+namespace helide {
+
+// One level of a MipChain. Texels are stored as float4, or as packed RGBA8
+// for 8-bit sources, in 4x4 (2D) or 4x4x4 (3D) tiles so that a filter
+// footprint touches as few cache lines as possible.
+struct MipLevel
+{
+  MipLevel(const uint3 &size, bool rgba8);
+
+  uint3 size() const;
+  bool rgba8() const;
+  float4 at(const uint3 &i) const;
+  void set(const uint3 &i, const float4 &v);
+
+ private:
+  size_t offset(const uint3 &i) const;
+
+  uint3 m_size;
+  uint3 m_tiles;
+  uint32_t m_tileShiftZ;
+  std::vector<float4> m_texels;
+  std::vector<uint32_t> m_texelsRGBA8;
+};
+
+// Image texels converted once per commit, optionally followed by box-filtered
+// levels down to 1x1(x1)
+struct MipChain
+{
+  static constexpr uint32_t TILE_SHIFT = 2;
+
+  // Whether an image of 'type' loses nothing when its levels are RGBA8
+  static bool storesAsRGBA8(ANARIDataType type);
+
+  // 'texel' returns the level 0 value at a uint3 coordinate, the levels past
+  // 0 are only built when 'mipmapped' is set
+  template <typename TEXEL_FCN>
+  void build(
+      const uint3 &size, bool rgba8, bool mipmapped, TEXEL_FCN &&texel);
+  void clear();
+
+  bool empty() const;
+  uint32_t numLevels() const;
+  const MipLevel &level(uint32_t l) const;
+  size_t memoryUsed() const;
+
+  // Filtered lookup in one level, 'coord' in [0, 1] texture space with the
+  // same texel-center convention as Array2D/Array3D sampling
+  float4 sample(uint32_t level,
+      const float3 &coord,
+      bool linear,
+      const WrapMode wrap[3]) const;
+
+  // Blends the two levels nearest to 'lod'
+  float4 sampleLod(
+      float lod, const float3 &coord, const WrapMode wrap[3]) const;
+
+ private:
+  void buildMipLevels();
+
+  std::vector<MipLevel> m_levels;
+};
+
+// Inlined definitions ////////////////////////////////////////////////////////
+
+inline uint3 MipLevel::size() const
+{
+  return m_size;
+}
+
+inline size_t MipLevel::offset(const uint3 &i) const
+{
+  constexpr uint32_t S = MipChain::TILE_SHIFT;
+  constexpr uint32_t M = (1u << S) - 1;
+  const uint32_t mz = (1u << m_tileShiftZ) - 1;
+  const size_t tz = i.z >> m_tileShiftZ;
+  const size_t tile =
+      (i.x >> S) + m_tiles.x * ((i.y >> S) + m_tiles.y * tz);
+  const uint32_t inner =
+      (i.x & M) + ((i.y & M) << S) + ((i.z & mz) << (2 * S));
+  return (tile << (2 * S + m_tileShiftZ)) + inner;
+}
+
+inline bool MipLevel::rgba8() const
+{
+  return !m_texelsRGBA8.empty();
+}
+
+inline float4 MipLevel::at(const uint3 &i) const
+{
+  if (!rgba8())
+    return m_texels[offset(i)];
+  const uint32_t v = m_texelsRGBA8[offset(i)];
+  return float4(float(v & 0xFF),
+             float((v >> 8) & 0xFF),
+             float((v >> 16) & 0xFF),
+             float(v >> 24))
+      * (1.f / 255.f);
+}
+
+inline void MipLevel::set(const uint3 &i, const float4 &v)
+{
+  if (!rgba8()) {
+    m_texels[offset(i)] = v;
+    return;
+  }
+  const auto c = linalg::clamp(v, 0.f, 1.f) * 255.f + 0.5f;
+  m_texelsRGBA8[offset(i)] = uint32_t(c.x) | (uint32_t(c.y) << 8)
+      | (uint32_t(c.z) << 16) | (uint32_t(c.w) << 24);
+}
+
+template <typename TEXEL_FCN>
+inline void MipChain::build(
+    const uint3 &size, bool rgba8, bool mipmapped, TEXEL_FCN &&texel)
+{
+  m_levels.clear();
+  m_levels.emplace_back(size, rgba8);
+
+  auto &l0 = m_levels[0];
+  embree::parallel_for(size_t(size.y) * size.z, [&](size_t row) {
+    const auto y = uint32_t(row % size.y);
+    const auto z = uint32_t(row / size.y);
+    for (uint32_t x = 0; x < size.x; x++)
+      l0.set(uint3(x, y, z), texel(uint3(x, y, z)));
+  });
+
+  if (mipmapped)
+    buildMipLevels();
+}
+
+} // namespace helide
@@ -3,11 +3,14 @@
 
 #include "Sampler.h"
 // subtypes
+#include "CompressedImage2D.h"
 #include "Image1D.h"
 #include "Image2D.h"
 #include "Image3D.h"
 #include "PrimitiveSampler.h"
 #include "TransformSampler.h"
+// helide
+#include "scene/surface/geometry/Geometry.h"
 
 namespace helide {
 
@@ -21,6 +24,8 @@ Sampler *Sampler::createInstance(std::string_view subtype, HelideGlobalState *s)
     return new Image2D(s);
   else if (subtype == "image3D")
     return new Image3D(s);
+  else if (subtype == "compressedImage2D")
+    return new CompressedImage2D(s);
   else if (subtype == "transform")
     return new TransformSampler(s);
   else if (subtype == "primitive")
@@ -29,6 +34,35 @@ Sampler *Sampler::createInstance(std::string_view subtype, HelideGlobalState *s)
     return (Sampler *)new UnknownObject(ANARI_SAMPLER, s);
 }
 
+float Sampler::textureLod(const Geometry &g,
+    const Attribute &attr,
+    const mat4 &inTransform,
+    const Ray &r,
+    const uint3 &imageSize)
+{
+  float3 p[3];
+  float4 a[3];
+  if (!g.getAttributeCorners(attr, r, p, a))
+    return 0.f;
+
+  // texel-space corners, flattened for 2D images
+  float3 t[3];
+  for (int i = 0; i < 3; i++) {
+    t[i] = linalg::mul(inTransform, a[i]).xyz() * float3(imageSize);
+    if (imageSize.z == 1)
+      t[i].z = 0.f;
+  }
+
+  const float objectArea = length(cross(p[1] - p[0], p[2] - p[0]));
+  const float texelArea = length(cross(t[1] - t[0], t[2] - t[0]));
+  if (objectArea == 0.f || texelArea == 0.f)
+    return 0.f;
+
+  const float footprint = r.coneWidth + r.tfar * r.coneSpread;
+  const float texels = footprint * std::sqrt(texelArea / objectArea);
+  return texels > 1.f ? std::log2(texels) : 0.f;
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Sampler *);
@@ -18,6 +18,16 @@ struct Sampler : public Object
 
   static Sampler *createInstance(
       std::string_view subtype, HelideGlobalState *d);
+
+ protected:
+  // Mip level matching the pixel footprint of 'r' on the surface it hit, from
+  // the texel density of 'attr' across the hit primitive; 0 when unknown.
+  // The footprint of 'r' must already be in the object space of the hit
+  static float textureLod(const Geometry &g,
+      const Attribute &attr,
+      const mat4 &inTransform,
+      const Ray &r,
+      const uint3 &imageSize);
 };
 
 } // namespace helide
@@ -2,11 +2,78 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "TransferFunction1D.h"
+// std
+#include <cmath>
+#include <cstring>
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
+// Adaptive sampling doubles the step while the normalized value changes by
+// less than this per step, up to MAX_STEP_SCALE times the base step
+constexpr float ADAPTIVE_VALUE_DELTA = 0.01f;
+constexpr float MAX_STEP_SCALE = 8.f;
+
+static float rayJitter(const VolumeRay &ray)
+{
+  uint32_t bits[6];
+  std::memcpy(&bits[0], &ray.org, sizeof(float3));
+  std::memcpy(&bits[3], &ray.dir, sizeof(float3));
+  uint32_t h = 0;
+  for (auto b : bits)
+    h = hashCombine(h, b);
+  return (h >> 8) * (1.f / 16777216.f);
+}
+
+// Walks the macrocells pierced by the ray in front-to-back order (3D DDA),
+// calling f(cellIndex, interval) until it returns false
+template <typename FUNC>
+static void traverseMacrocells(
+    const MacrocellGrid &grid, const VolumeRay &ray, FUNC &&f)
+{
+  const float3 org = (ray.org - grid.origin) / grid.cellSize;
+  const float3 dir = ray.dir / grid.cellSize;
+  const float3 p = org + dir * ray.t.lower;
+
+  int cell[3];
+  int step[3];
+  float tNext[3];
+  float tDelta[3];
+  for (int a = 0; a < 3; a++) {
+    const int last = int(grid.dims[a]) - 1;
+    cell[a] = std::clamp(int(std::floor(p[a])), 0, last);
+    step[a] = dir[a] < 0.f ? -1 : 1;
+    if (dir[a] == 0.f) {
+      tNext[a] = std::numeric_limits<float>::infinity();
+      tDelta[a] = std::numeric_limits<float>::infinity();
+    } else {
+      const float boundary = float(cell[a] + (step[a] > 0 ? 1 : 0));
+      tNext[a] = (boundary - org[a]) / dir[a];
+      tDelta[a] = std::abs(1.f / dir[a]);
+    }
+  }
+
+  float t = ray.t.lower;
+  while (t < ray.t.upper) {
+    const int a = tNext[0] < tNext[1] ? (tNext[0] < tNext[2] ? 0 : 2)
+                                      : (tNext[1] < tNext[2] ? 1 : 2);
+    const float tExit = std::min(tNext[a], ray.t.upper);
+    const size_t i = cell[0]
+        + size_t(grid.dims.x) * (cell[1] + size_t(grid.dims.y) * cell[2]);
+    if (!f(i, box1(t, tExit)))
+      return;
+
+    t = tExit;
+    cell[a] += step[a];
+    if (cell[a] < 0 || cell[a] >= int(grid.dims[a]))
+      return;
+    tNext[a] += tDelta[a];
+  }
+}
+
 TransferFunction1D::TransferFunction1D(HelideGlobalState *d)
-    : Volume(d), m_field(this)
+    : Volume(d), m_field(this), m_colorData(this), m_opacityData(this)
 {}
 
 TransferFunction1D::~TransferFunction1D() = default;
@@ -29,6 +96,16 @@ void TransferFunction1D::commit()
   m_opacityData = getParamObject<Array1D>("opacity");
   m_densityScale = getParam<float>("densityScale", 1.f);
 
+  m_samplingRate = getParam<float>("samplingRate", 1.f);
+  if (!(m_samplingRate > 0.f)) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'samplingRate' on transferFunction1D volume must be > 0, using 1");
+    m_samplingRate = 1.f;
+  }
+  m_opacityThreshold = getParam<float>("opacityThreshold", 0.99f);
+  m_jitter = getParam<bool>("jitter", false);
+  m_adaptiveSampling = getParam<bool>("adaptiveSampling", false);
+
   if (!m_colorData) {
     reportMessage(ANARI_SEVERITY_WARNING,
         "no color data provided to transferFunction1D volume");
@@ -39,11 +116,26 @@ void TransferFunction1D::commit()
         "no opacity data provided to transfer function");
     return;
   }
+  if (m_opacityData->elementType() != ANARI_FLOAT32) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "'opacity' array on transferFunction1D volume must be ANARI_FLOAT32");
+    return;
+  }
+
+  buildMacrocellOpacities();
+
+  if (getParam<bool>("preintegration", false))
+    updatePreintegrationTable();
+  else {
+    m_preintegrated.clear();
+    m_preintegrationKey = {};
+  }
 }
 
 bool TransferFunction1D::isValid() const
 {
-  return m_field && m_field->isValid() && m_colorData && m_opacityData;
+  return m_field && m_field->isValid() && m_colorData && m_opacityData
+      && m_opacityData->elementType() == ANARI_FLOAT32;
 }
 
 box3 TransferFunction1D::bounds() const
@@ -51,27 +143,162 @@ box3 TransferFunction1D::bounds() const
   return m_field->bounds();
 }
 
-void TransferFunction1D::render(
+uint32_t TransferFunction1D::render(
     const VolumeRay &vray, float3 &color, float &opacity)
 {
-  const float stepSize = field()->stepSize();
-  const float jitter = 1.f; // NOTE: use uniform rng if/when lower sampling rate
+  // Opacities are defined per field step, so rescale them for other steps
+  const float unitStep = field()->stepSize();
+  const float baseStep = unitStep / m_samplingRate;
+  const float maxStep =
+      m_adaptiveSampling ? baseStep * MAX_STEP_SCALE : baseStep;
+  const float jitter = m_jitter ? rayJitter(vray) : 1.f;
   box1 currentInterval = vray.t;
-  currentInterval.lower += stepSize * jitter;
+  currentInterval.lower += baseStep * jitter;
 
-  while (opacity < 0.99f && size(currentInterval) >= 0.f) {
-    const float3 p = vray.org + vray.dir * currentInterval.lower;
-    const float s = field()->sampleAt(p);
+  const bool usePreintegration = !m_preintegrated.empty();
 
-    if (!std::isnan(s)) {
-      const float3 c = colorOf(s);
-      const float o = opacityOf(s) * m_densityScale;
-      accumulateValue(color, c * o, opacity);
-      accumulateValue(opacity, o, opacity);
+  float stepSize = baseStep;
+  float prevSample = NAN;
+  uint32_t numSamples = 0;
+  auto march = [&](float tEnd) {
+    while (opacity < m_opacityThreshold && currentInterval.lower <= tEnd) {
+      const float3 p = vray.org + vray.dir * currentInterval.lower;
+      const float s = field()->sampleAt(p);
+      numSamples++;
+
+      if (!std::isnan(s)) {
+        float3 c(0.f); // premultiplied by 'o'
+        float o = 0.f;
+        if (usePreintegration && !std::isnan(prevSample)) {
+          const float4 segment = preintegrated(prevSample, s);
+          o = segment.w;
+          if (stepSize != unitStep && o > 0.f) {
+            const float oc = 1.f - std::pow(1.f - o, stepSize / unitStep);
+            c = float3(segment.x, segment.y, segment.z) * (oc / o);
+            o = oc;
+          } else
+            c = float3(segment.x, segment.y, segment.z);
+        } else {
+          o = std::clamp(opacityOf(s) * m_densityScale, 0.f, 1.f);
+          if (stepSize != unitStep)
+            o = 1.f - std::pow(1.f - o, stepSize / unitStep);
+          c = colorOf(s) * o;
+        }
+        accumulateValue(color, c, opacity);
+        accumulateValue(opacity, o, opacity);
+
+        if (m_adaptiveSampling) {
+          const float delta = std::abs(s - prevSample) * m_invSize;
+          stepSize = delta < ADAPTIVE_VALUE_DELTA * (stepSize / baseStep)
+              ? std::min(stepSize * 2.f, maxStep)
+              : baseStep;
+        }
+      }
+      prevSample = s;
+
+      currentInterval.lower += stepSize;
     }
+  };
+
+  const auto &grid = field()->macrocells();
+  if (m_macrocellOpacity.empty()
+      || m_macrocellOpacity.size() != grid.numCells()) {
+    march(currentInterval.upper);
+    return numSamples;
+  }
+
+  traverseMacrocells(grid, vray, [&](size_t i, box1 cell) {
+    const float tEnd = std::min(cell.upper, currentInterval.upper);
+    if (m_macrocellOpacity[i] > 0.f)
+      march(tEnd);
+    else if (currentInterval.lower <= tEnd) {
+      // skip to the first step past the empty cell, keeping steps aligned
+      const float n = std::floor((tEnd - currentInterval.lower) / stepSize);
+      currentInterval.lower += (n + 1.f) * stepSize;
+      prevSample = NAN;
+    }
+    return opacity < m_opacityThreshold;
+  });
+
+  return numSamples;
+}
+
+void TransferFunction1D::buildMacrocellOpacities()
+{
+  m_macrocellOpacity.clear();
 
-    currentInterval.lower += stepSize;
+  const auto &grid = field()->macrocells();
+  if (grid.empty())
+    return;
+
+  // read the same values as opacityOf(), only the interpolation differs
+  const float *opacities = m_opacityData->dataAs<float>();
+  const size_t n = m_opacityData->size();
+  const float maxIndex = float(n - 1);
+
+  // Linear interpolation never exceeds the neighboring entries, so the max
+  // over the covered entries bounds the opacity of any sample in the cell
+  m_macrocellOpacity.resize(grid.valueRanges.size(), 0.f);
+  for (size_t i = 0; i < grid.valueRanges.size(); i++) {
+    const box1 &r = grid.valueRanges[i];
+    if (r.lower > r.upper)
+      continue; // no valid voxels
+    const size_t first = size_t(std::floor(normalized(r.lower) * maxIndex));
+    const size_t last = size_t(std::ceil(normalized(r.upper) * maxIndex));
+    float o = 0.f;
+    for (size_t j = first; j <= std::min(last, n - 1); j++)
+      o = std::max(o, opacities[j]);
+    m_macrocellOpacity[i] = o * m_densityScale;
   }
 }
 
+void TransferFunction1D::updatePreintegrationTable()
+{
+  // The table is expensive to build, so only rebuild it when the transfer
+  // function content changed (it is indexed by normalized value, so the
+  // value range does not affect it)
+  auto lastChanged = [](const Array1D &a) {
+    return std::max(a.lastDataModified(), a.lastUpdated());
+  };
+  const bool upToDate = !m_preintegrated.empty()
+      && m_preintegrationKey.color == m_colorData.get()
+      && m_preintegrationKey.opacity == m_opacityData.get()
+      && m_preintegrationKey.densityScale == m_densityScale
+      && lastChanged(*m_colorData) < m_preintegrationKey.built
+      && lastChanged(*m_opacityData) < m_preintegrationKey.built;
+  if (upToDate)
+    return;
+
+  reportMessage(
+      ANARI_SEVERITY_DEBUG, "helide::TransferFunction1D preintegrating");
+
+  // Composite each segment in substeps, one per table entry it crosses, with
+  // substep opacities corrected so the whole segment spans one field step
+  const uint32_t N = PREINTEGRATION_SIZE;
+  m_preintegrated.resize(size_t(N) * N);
+  embree::parallel_for(size_t(N), [&](size_t f) {
+    for (uint32_t b = 0; b < N; b++) {
+      const int numSteps = std::max(1, std::abs(int(b) - int(f)));
+      const float nf = f / float(N - 1);
+      const float nb = b / float(N - 1);
+      float3 color(0.f);
+      float opacity = 0.f;
+      for (int i = 0; i < numSteps; i++) {
+        const float v = linalg::lerp(nf, nb, (i + 0.5f) / numSteps);
+        const float3 c = m_colorData->valueAtLinear<float3>(v);
+        float o = m_opacityData->valueAtLinear<float>(v) * m_densityScale;
+        o = 1.f - std::pow(1.f - std::clamp(o, 0.f, 1.f), 1.f / numSteps);
+        accumulateValue(color, c * o, opacity);
+        accumulateValue(opacity, o, opacity);
+      }
+      m_preintegrated[f * N + b] = float4(color, opacity);
+    }
+  });
+
+  m_preintegrationKey.color = m_colorData.get();
+  m_preintegrationKey.opacity = m_opacityData.get();
+  m_preintegrationKey.densityScale = m_densityScale;
+  m_preintegrationKey.built = helium::newTimeStamp();
+}
+
 } // namespace helide
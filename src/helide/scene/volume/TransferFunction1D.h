@@ -20,11 +20,14 @@ struct TransferFunction1D : public Volume
 
   box3 bounds() const override;
 
-  void render(const VolumeRay &vray,
+  uint32_t render(const VolumeRay &vray,
       float3 &outputColor,
       float &outputOpacity) override;
 
  private:
+  // Entries per axis of the preintegrated (front, back) sample table
+  static constexpr uint32_t PREINTEGRATION_SIZE = 256;
+
   float3 colorOf(float sample) const;
   float opacityOf(float sample) const;
 
@@ -32,6 +35,10 @@ struct TransferFunction1D : public Volume
 
   float normalized(float in) const;
 
+  void buildMacrocellOpacities();
+  void updatePreintegrationTable();
+  float4 preintegrated(float front, float back) const;
+
   // Data //
 
   helium::ChangeObserverPtr<SpatialField> m_field;
@@ -40,8 +47,27 @@ struct TransferFunction1D : public Volume
   float m_invSize{0.f};
   float m_densityScale{1.f};
 
-  helium::IntrusivePtr<Array1D> m_colorData;
-  helium::IntrusivePtr<Array1D> m_opacityData;
+  float m_samplingRate{1.f};
+  float m_opacityThreshold{0.99f};
+  bool m_jitter{false};
+  bool m_adaptiveSampling{false};
+
+  helium::ChangeObserverPtr<Array1D> m_colorData;
+  helium::ChangeObserverPtr<Array1D> m_opacityData;
+
+  // Max opacity per cell of the field's macrocell grid, zero cells are skipped
+  std::vector<float> m_macrocellOpacity;
+
+  // Premultiplied color and opacity of a field step between two normalized
+  // values, empty unless 'preintegration' is enabled
+  std::vector<float4> m_preintegrated;
+  struct PreintegrationKey // inputs the table was last built from
+  {
+    const Array1D *color{nullptr};
+    const Array1D *opacity{nullptr};
+    float densityScale{0.f};
+    helium::TimeStamp built{0};
+  } m_preintegrationKey;
 };
 
 // Inlined defintions /////////////////////////////////////////////////////////
@@ -61,6 +87,15 @@ inline float TransferFunction1D::opacityOf(float sample) const
   return m_opacityData->valueAtLinear<float>(normalized(sample));
 }
 
+inline float4 TransferFunction1D::preintegrated(
+    float front, float back) const
+{
+  constexpr float maxIndex = PREINTEGRATION_SIZE - 1;
+  const auto f = uint32_t(normalized(front) * maxIndex + 0.5f);
+  const auto b = uint32_t(normalized(back) * maxIndex + 0.5f);
+  return m_preintegrated[f * PREINTEGRATION_SIZE + b];
+}
+
 inline float TransferFunction1D::normalized(float sample) const
 {
   return std::clamp(position(sample, m_valueRange), 0.f, 1.f);
@@ -4,6 +4,8 @@
 #include "Volume.h"
 // subtypes
 #include "TransferFunction1D.h"
+// helide
+#include "scene/Group.h"
 
 namespace helide {
 
@@ -22,6 +24,23 @@ void Volume::commit()
   m_id = getParam<uint32_t>("id", ~0u);
 }
 
+void Volume::markCommitted()
+{
+  Object::markCommitted();
+  notifyChangeObservers();
+  deviceState()->objectUpdates.lastBLSCommitSceneRequest =
+      helium::newTimeStamp();
+}
+
+void Volume::notifyChangeObserver(helium::BaseObject *o) const
+{
+  // Volume bounds live in the group's volume BLS, which only needs a recommit
+  if (o->type() == ANARI_GROUP)
+    ((Group *)o)->markBLSCommitRequested();
+  else
+    Object::notifyChangeObserver(o);
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_DEFINITION(helide::Volume *);
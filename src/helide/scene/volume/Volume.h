@@ -14,13 +14,18 @@ struct Volume : public Object
   static Volume *createInstance(std::string_view subtype, HelideGlobalState *d);
 
   void commit() override;
+  void markCommitted() override;
 
   uint32_t id() const;
 
   virtual box3 bounds() const = 0;
-  virtual void render(
+  // returns the number of field samples taken
+  virtual uint32_t render(
       const VolumeRay &vray, float3 &outputColor, float &outputOpacity) = 0;
 
+  protected:
+  void notifyChangeObserver(helium::BaseObject *o) const override;
+
   private:
   uint32_t m_id{~0u};
 };
@@ -4,9 +4,23 @@
 #pragma once
 
 #include "Object.h"
+// std
+#include <vector>
 
 namespace helide {
 
+// Coarse grid of conservative value ranges, used to skip empty space
+struct MacrocellGrid
+{
+  uint3 dims{0u};
+  float3 origin{0.f}; // object space
+  float3 cellSize{1.f}; // object space
+  std::vector<box1> valueRanges; // x-fastest, one per cell
+
+  bool empty() const;
+  size_t numCells() const;
+};
+
 struct SpatialField : public Object
 {
   SpatialField(HelideGlobalState *d);
@@ -20,20 +34,44 @@ struct SpatialField : public Object
 
   float stepSize() const;
 
+  const MacrocellGrid &macrocells() const;
+
  protected:
   void setStepSize(float size);
+  MacrocellGrid &macrocells();
 
  private:
   float m_stepSize{0.f};
+  MacrocellGrid m_macrocells;
 };
 
 // Inlined definitions ////////////////////////////////////////////////////////
 
+inline bool MacrocellGrid::empty() const
+{
+  return valueRanges.empty();
+}
+
+inline size_t MacrocellGrid::numCells() const
+{
+  return size_t(dims.x) * dims.y * dims.z;
+}
+
 inline float SpatialField::stepSize() const
 {
   return m_stepSize;
 }
 
+inline const MacrocellGrid &SpatialField::macrocells() const
+{
+  return m_macrocells;
+}
+
+inline MacrocellGrid &SpatialField::macrocells()
+{
+  return m_macrocells;
+}
+
 } // namespace helide
 
 HELIDE_ANARI_TYPEFOR_SPECIALIZATION(
@@ -3,17 +3,56 @@
 
 #include "StructuredRegularField.h"
 // std
+#include <cmath>
+#include <cstring>
 #include <limits>
+#include <type_traits>
+// embree
+#include "algorithms/parallel_for.h"
 
 namespace helide {
 
+// Voxels per macrocell edge
+constexpr uint32_t MACROCELL_SIZE = 16;
+
+// Bricks are 8^3 voxels, so a float brick spans 32 cache lines
+constexpr uint32_t BRICK_SHIFT = 3;
+constexpr uint32_t BRICK_SIZE = 1u << BRICK_SHIFT;
+constexpr uint32_t BRICK_MASK = BRICK_SIZE - 1;
+constexpr size_t BRICK_VOXELS = BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;
+
+// Helper functions ///////////////////////////////////////////////////////////
+
+template <typename T>
+static float toNormalizedFloat(T v)
+{
+  if constexpr (std::is_floating_point_v<T>)
+    return float(v);
+  else
+    return v / float(std::numeric_limits<T>::max());
+}
+
+// StructuredRegularField definitions /////////////////////////////////////////
+
 StructuredRegularField::StructuredRegularField(HelideGlobalState *d)
-    : SpatialField(d)
+    : SpatialField(d), m_dataArray(this)
 {}
 
+bool StructuredRegularField::getProperty(
+    const std::string_view &name, ANARIDataType type, void *ptr, uint32_t flags)
+{
+  if (name == "memoryOverhead" && type == ANARI_UINT64) {
+    helium::writeToVoidP(ptr, uint64_t(m_brickedData.size()));
+    return true;
+  }
+
+  return SpatialField::getProperty(name, type, ptr, flags);
+}
+
 void StructuredRegularField::commit()
 {
   m_dataArray = getParamObject<Array3D>("data");
+  macrocells() = MacrocellGrid();
 
   if (!m_dataArray) {
     reportMessage(ANARI_SEVERITY_WARNING,
@@ -25,6 +64,30 @@ void StructuredRegularField::commit()
   m_type = m_dataArray->elementType();
   m_dims = m_dataArray->size();
 
+  const auto layout = getParamString("layout", "linear");
+  m_bricked = layout == "bricked";
+  if (!m_bricked && layout != "linear") {
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unknown layout '%s' on 'structuredRegular' field, using 'linear'",
+        layout.c_str());
+  }
+
+  if (m_bricked) {
+    copyToBricks();
+    m_data = m_brickedData.data();
+  } else {
+    m_brickedData.clear();
+    m_brickedData.shrink_to_fit();
+    m_strides[0] = 1;
+    m_strides[1] = m_dims.x;
+    m_strides[2] = size_t(m_dims.x) * m_dims.y;
+  }
+
+  if (m_bricked)
+    selectSamplers<true>();
+  else
+    selectSamplers<false>();
+
   m_origin = getParam<float3>("origin", float3(0.f));
   m_spacing = getParam<float3>("spacing", float3(1.f));
 
@@ -34,6 +97,8 @@ void StructuredRegularField::commit()
       std::nextafter(m_dims.z - 1, 0));
 
   setStepSize(linalg::minelem(m_spacing / 2.f));
+
+  buildMacrocells();
 }
 
 bool StructuredRegularField::isValid() const
@@ -51,31 +116,7 @@ float StructuredRegularField::sampleAt(const float3 &coord) const
     return NAN;
   }
 
-  const float3 clampedLocal =
-      linalg::clamp(local, float3(0.f), m_coordUpperBound);
-
-  const uint3 vi0 = uint3(clampedLocal);
-  const uint3 vi1 = linalg::clamp(vi0 + 1, uint3(0u), m_dims - 1);
-
-  const float3 fracLocal = clampedLocal - float3(vi0);
-
-  const float voxel_000 = valueAtVoxel(uint3(vi0.x, vi0.y, vi0.z));
-  const float voxel_001 = valueAtVoxel(uint3(vi1.x, vi0.y, vi0.z));
-  const float voxel_010 = valueAtVoxel(uint3(vi0.x, vi1.y, vi0.z));
-  const float voxel_011 = valueAtVoxel(uint3(vi1.x, vi1.y, vi0.z));
-  const float voxel_100 = valueAtVoxel(uint3(vi0.x, vi0.y, vi1.z));
-  const float voxel_101 = valueAtVoxel(uint3(vi1.x, vi0.y, vi1.z));
-  const float voxel_110 = valueAtVoxel(uint3(vi0.x, vi1.y, vi1.z));
-  const float voxel_111 = valueAtVoxel(uint3(vi1.x, vi1.y, vi1.z));
-
-  const float voxel_00 = linalg::lerp(voxel_000, voxel_001, fracLocal.x);
-  const float voxel_01 = linalg::lerp(voxel_010, voxel_011, fracLocal.x);
-  const float voxel_10 = linalg::lerp(voxel_100, voxel_101, fracLocal.x);
-  const float voxel_11 = linalg::lerp(voxel_110, voxel_111, fracLocal.x);
-  const float voxel_0 = linalg::lerp(voxel_00, voxel_01, fracLocal.y);
-  const float voxel_1 = linalg::lerp(voxel_10, voxel_11, fracLocal.y);
-
-  return linalg::lerp(voxel_0, voxel_1, fracLocal.z);
+  return (this->*m_sampleFcn)(local);
 }
 
 box3 StructuredRegularField::bounds() const
@@ -92,26 +133,189 @@ float3 StructuredRegularField::objectToLocal(const float3 &object) const
 
 float StructuredRegularField::valueAtVoxel(const uint3 &index) const
 {
-  const size_t i = size_t(index.x)
-      + m_dims.x * (size_t(index.y) + m_dims.y * size_t(index.z));
+  return (this->*m_voxelFcn)(voxelIndex(index));
+}
+
+size_t StructuredRegularField::voxelIndex(const uint3 &index) const
+{
+  if (m_bricked) {
+    return axisOffset<true>(index.x, 0) + axisOffset<true>(index.y, 1)
+        + axisOffset<true>(index.z, 2);
+  } else {
+    return axisOffset<false>(index.x, 0) + axisOffset<false>(index.y, 1)
+        + axisOffset<false>(index.z, 2);
+  }
+}
 
+// Both layouts are separable per axis, so the 8 trilinear corners can be
+// gathered from 2 offsets along each axis
+template <bool BRICKED>
+size_t StructuredRegularField::axisOffset(uint32_t v, int axis) const
+{
+  if constexpr (BRICKED) {
+    const size_t inBrickStride = size_t(1) << (BRICK_SHIFT * axis);
+    return (v >> BRICK_SHIFT) * m_strides[axis]
+        + (v & BRICK_MASK) * inBrickStride;
+  } else
+    return v * m_strides[axis];
+}
+
+template <bool BRICKED>
+void StructuredRegularField::selectSamplers()
+{
   switch (m_type) {
   case ANARI_FLOAT32:
-    return ((float *)m_data)[i];
+    m_sampleFcn = &StructuredRegularField::sampleTrilinear<float, BRICKED>;
+    m_voxelFcn = &StructuredRegularField::voxelValue<float>;
+    break;
   case ANARI_FLOAT64:
-    return ((double *)m_data)[i];
+    m_sampleFcn = &StructuredRegularField::sampleTrilinear<double, BRICKED>;
+    m_voxelFcn = &StructuredRegularField::voxelValue<double>;
+    break;
   case ANARI_UFIXED8:
-    return ((uint8_t *)m_data)[i] / float(std::numeric_limits<uint8_t>::max());
+    m_sampleFcn = &StructuredRegularField::sampleTrilinear<uint8_t, BRICKED>;
+    m_voxelFcn = &StructuredRegularField::voxelValue<uint8_t>;
+    break;
   case ANARI_UFIXED16:
-    return ((uint16_t *)m_data)[i]
-        / float(std::numeric_limits<uint16_t>::max());
+    m_sampleFcn = &StructuredRegularField::sampleTrilinear<uint16_t, BRICKED>;
+    m_voxelFcn = &StructuredRegularField::voxelValue<uint16_t>;
+    break;
   case ANARI_FIXED16:
-    return ((int16_t *)m_data)[i] / float(std::numeric_limits<int16_t>::max());
+    m_sampleFcn = &StructuredRegularField::sampleTrilinear<int16_t, BRICKED>;
+    m_voxelFcn = &StructuredRegularField::voxelValue<int16_t>;
+    break;
   default:
+    reportMessage(ANARI_SEVERITY_WARNING,
+        "unsupported element type '%s' on 'structuredRegular' field",
+        anari::toString(m_type));
+    m_sampleFcn = &StructuredRegularField::sampleUnsupported;
+    m_voxelFcn = &StructuredRegularField::voxelUnsupported;
     break;
   }
+}
+
+void StructuredRegularField::copyToBricks()
+{
+  const uint3 numBricks = (m_dims + BRICK_MASK) >> BRICK_SHIFT;
+  m_strides[0] = BRICK_VOXELS;
+  m_strides[1] = numBricks.x * BRICK_VOXELS;
+  m_strides[2] = size_t(numBricks.x) * numBricks.y * BRICK_VOXELS;
+
+  // Voxels padding the last bricks are never read, as samples are clamped
+  const size_t elementSize = anari::sizeOf(m_type);
+  const size_t totalBricks = size_t(numBricks.x) * numBricks.y * numBricks.z;
+  m_brickedData.assign(totalBricks * BRICK_VOXELS * elementSize, 0);
+
+  const auto *src = (const uint8_t *)m_dataArray->data();
+  auto *dst = m_brickedData.data();
+  embree::parallel_for(size_t(m_dims.z), [&](size_t z) {
+    for (uint32_t y = 0; y < m_dims.y; y++) {
+      for (uint32_t x = 0; x < m_dims.x; x++) {
+        const size_t in = x + m_dims.x * (y + size_t(m_dims.y) * z);
+        const size_t out = axisOffset<true>(x, 0) + axisOffset<true>(y, 1)
+            + axisOffset<true>(uint32_t(z), 2);
+        std::memcpy(
+            dst + out * elementSize, src + in * elementSize, elementSize);
+      }
+    }
+  });
+}
+
+template <typename T>
+float StructuredRegularField::voxelValue(size_t i) const
+{
+  return toNormalizedFloat(((const T *)m_data)[i]);
+}
+
+template <typename T, bool BRICKED>
+float StructuredRegularField::sampleTrilinear(const float3 &local) const
+{
+  const float3 clampedLocal =
+      linalg::clamp(local, float3(0.f), m_coordUpperBound);
+
+  const uint3 vi0 = uint3(clampedLocal);
+  const uint3 vi1 = linalg::clamp(vi0 + 1, uint3(0u), m_dims - 1);
+
+  const float3 fracLocal = clampedLocal - float3(vi0);
+
+  // Gather all 8 corners from per-axis offsets, without any type dispatch
+  const size_t x0 = axisOffset<BRICKED>(vi0.x, 0);
+  const size_t x1 = axisOffset<BRICKED>(vi1.x, 0);
+  const size_t y0 = axisOffset<BRICKED>(vi0.y, 1);
+  const size_t y1 = axisOffset<BRICKED>(vi1.y, 1);
+  const size_t z0 = axisOffset<BRICKED>(vi0.z, 2);
+  const size_t z1 = axisOffset<BRICKED>(vi1.z, 2);
+
+  const T *data = (const T *)m_data;
+  const float voxel_000 = toNormalizedFloat(data[x0 + y0 + z0]);
+  const float voxel_001 = toNormalizedFloat(data[x1 + y0 + z0]);
+  const float voxel_010 = toNormalizedFloat(data[x0 + y1 + z0]);
+  const float voxel_011 = toNormalizedFloat(data[x1 + y1 + z0]);
+  const float voxel_100 = toNormalizedFloat(data[x0 + y0 + z1]);
+  const float voxel_101 = toNormalizedFloat(data[x1 + y0 + z1]);
+  const float voxel_110 = toNormalizedFloat(data[x0 + y1 + z1]);
+  const float voxel_111 = toNormalizedFloat(data[x1 + y1 + z1]);
 
+  const float voxel_00 = linalg::lerp(voxel_000, voxel_001, fracLocal.x);
+  const float voxel_01 = linalg::lerp(voxel_010, voxel_011, fracLocal.x);
+  const float voxel_10 = linalg::lerp(voxel_100, voxel_101, fracLocal.x);
+  const float voxel_11 = linalg::lerp(voxel_110, voxel_111, fracLocal.x);
+  const float voxel_0 = linalg::lerp(voxel_00, voxel_01, fracLocal.y);
+  const float voxel_1 = linalg::lerp(voxel_10, voxel_11, fracLocal.y);
+
+  return linalg::lerp(voxel_0, voxel_1, fracLocal.z);
+}
+
+float StructuredRegularField::sampleUnsupported(const float3 &) const
+{
   return NAN;
 }
 
+float StructuredRegularField::voxelUnsupported(size_t) const
+{
+  return NAN;
+}
+
+void StructuredRegularField::buildMacrocells()
+{
+  auto &grid = macrocells();
+
+  auto numCells = [](uint32_t voxels) {
+    return std::max(1u, (voxels - 1 + MACROCELL_SIZE - 1) / MACROCELL_SIZE);
+  };
+
+  grid.dims = uint3(numCells(m_dims.x), numCells(m_dims.y), numCells(m_dims.z));
+  grid.origin = m_origin;
+  grid.cellSize = m_spacing * float(MACROCELL_SIZE);
+  grid.valueRanges.resize(grid.numCells());
+
+  // Cells share their boundary voxels, which trilinear sampling reads from
+  // both sides, so the ranges stay conservative
+  embree::parallel_for(size_t(grid.dims.z), [&](size_t cz) {
+    for (uint32_t cy = 0; cy < grid.dims.y; cy++) {
+      for (uint32_t cx = 0; cx < grid.dims.x; cx++) {
+        const uint3 lo = uint3(cx, cy, uint32_t(cz)) * MACROCELL_SIZE;
+        const uint3 hi = linalg::min(lo + MACROCELL_SIZE, m_dims - 1);
+
+        box1 range(std::numeric_limits<float>::max(),
+            -std::numeric_limits<float>::max());
+        for (uint32_t z = lo.z; z <= hi.z; z++) {
+          for (uint32_t y = lo.y; y <= hi.y; y++) {
+            for (uint32_t x = lo.x; x <= hi.x; x++) {
+              const float v = valueAtVoxel(uint3(x, y, z));
+              if (!std::isnan(v)) {
+                range.lower = std::min(range.lower, v);
+                range.upper = std::max(range.upper, v);
+              }
+            }
+          }
+        }
+
+        const size_t i = cx + grid.dims.x * (cy + grid.dims.y * cz);
+        grid.valueRanges[i] = range;
+      }
+    }
+  });
+}
+
 } // namespace helide
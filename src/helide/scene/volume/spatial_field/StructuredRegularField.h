@@ -12,6 +12,11 @@ struct StructuredRegularField : public SpatialField
 {
   StructuredRegularField(HelideGlobalState *d);
 
+  bool getProperty(const std::string_view &name,
+      ANARIDataType type,
+      void *ptr,
+      uint32_t flags) override;
+
   void commit() override;
 
   bool isValid() const override;
@@ -23,6 +28,24 @@ struct StructuredRegularField : public SpatialField
  private:
   float3 objectToLocal(const float3 &object) const;
   float valueAtVoxel(const uint3 &index) const;
+  size_t voxelIndex(const uint3 &index) const;
+  template <bool BRICKED>
+  size_t axisOffset(uint32_t v, int axis) const;
+  void copyToBricks();
+  void buildMacrocells();
+
+  // Samplers specialized per element type and layout, selected on commit
+  template <bool BRICKED>
+  void selectSamplers();
+  template <typename T, bool BRICKED>
+  float sampleTrilinear(const float3 &local) const;
+  template <typename T>
+  float voxelValue(size_t i) const;
+  float sampleUnsupported(const float3 &local) const;
+  float voxelUnsupported(size_t i) const;
+
+  using SampleFcn = float (StructuredRegularField::*)(const float3 &) const;
+  using VoxelFcn = float (StructuredRegularField::*)(size_t) const;
 
   // Data //
 
@@ -32,10 +55,18 @@ struct StructuredRegularField : public SpatialField
   float3 m_invSpacing;
   float3 m_coordUpperBound;
 
-  helium::IntrusivePtr<Array3D> m_dataArray;
+  helium::ChangeObserverPtr<Array3D> m_dataArray;
 
   const void *m_data{nullptr};
   anari::DataType m_type{ANARI_UNKNOWN};
+
+  // Optional copy of the data in 8^3 bricks, 'm_data' points here if used
+  bool m_bricked{false};
+  std::vector<uint8_t> m_brickedData;
+  size_t m_strides[3]{0, 0, 0}; // per axis, between voxels or bricks
+
+  SampleFcn m_sampleFcn{&StructuredRegularField::sampleUnsupported};
+  VoxelFcn m_voxelFcn{&StructuredRegularField::voxelUnsupported};
 };
 
 } // namespace helide
@@ -123,6 +123,11 @@ bool Array::wasPrivatized() const
   return m_privatized;
 }
 
+helium::TimeStamp Array::lastDataModified() const
+{
+  return m_lastDataModified;
+}
+
 void Array::markDataModified()
 {
   m_lastDataModified = helium::newTimeStamp();
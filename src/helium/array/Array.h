@@ -71,6 +71,7 @@ struct Array : public BaseArray
   virtual void privatize() override = 0;
 
   bool isMapped() const;
+  helium::TimeStamp lastDataModified() const;
 
   bool wasPrivatized() const;
 
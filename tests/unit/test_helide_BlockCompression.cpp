@@ -0,0 +1,353 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+
+// helide
+#include "scene/surface/material/sampler/BlockCompression.h"
+// std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace {
+
+using namespace helide;
+
+using Block = std::array<uint8_t, 16>;
+using Texels = std::array<float4, 16>;
+
+Texels decode(const char *format, const Block &block)
+{
+  Texels texels;
+  decodeBlock(compressedFormatFromString(format), block.data(), texels.data());
+  return texels;
+}
+
+void requireTexel(const float4 &texel, const float4 &expected)
+{
+  REQUIRE(texel.x == Approx(expected.x).margin(1e-5f));
+  REQUIRE(texel.y == Approx(expected.y).margin(1e-5f));
+  REQUIRE(texel.z == Approx(expected.z).margin(1e-5f));
+  REQUIRE(texel.w == Approx(expected.w).margin(1e-5f));
+}
+
+// BC7 texels are 8-bit values before normalization
+void requireTexel8(const float4 &texel, int r, int g, int b, int a)
+{
+  requireTexel(texel * 255.f, float4(r, g, b, a));
+}
+
+// BC6H texels are exact half-float values
+void requireTexelHalf(const float4 &texel, float r, float g, float b)
+{
+  REQUIRE(texel.x == r);
+  REQUIRE(texel.y == g);
+  REQUIRE(texel.z == b);
+  REQUIRE(texel.w == 1.f);
+}
+
+// Blocks of BC7 modes 0, 1, 2, 3 and 7 that use partition 0, with subset 0
+// interpolating from black to red, subset 1 to green and subset 2 to blue, all
+// p-bits 0 and every texel using its largest index: the full channel value is
+// the largest endpoint the mode can store with a 0 p-bit, and anchor texels
+// store one index bit less so they land on 'anchorValue' instead
+void requirePartitionedBC7(const Block &block,
+    int numSubsets,
+    int fullValue,
+    int anchorValue,
+    int alpha)
+{
+  // partition 0 of the BC7 specification
+  constexpr int SUBSETS2[16] = {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1};
+  constexpr int SUBSETS3[16] = {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2};
+  const bool twoSubsets = numSubsets == 2;
+
+  auto texels = decode("BC7", block);
+  for (int i = 0; i < 16; i++) {
+    const int s = twoSubsets ? SUBSETS2[i] : SUBSETS3[i];
+    const bool anchor = i == 0 || i == 15 || (!twoSubsets && i == 3);
+    const int v = anchor ? anchorValue : fullValue;
+    requireTexel8(
+        texels[i], s == 0 ? v : 0, s == 1 ? v : 0, s == 2 ? v : 0, alpha);
+  }
+}
+
+SCENARIO("helide block compressed texel decoding", "[helide_BlockCompression]")
+{
+  GIVEN("A BC1 block with red and blue endpoints and c0 > c1")
+  {
+    const Block block = {0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4};
+
+    THEN("Each row reads the four interpolated palette colors")
+    {
+      auto texels = decode("BC1_RGB", block);
+      for (int row = 0; row < 4; row++) {
+        requireTexel(texels[4 * row + 0], float4(1.f, 0.f, 0.f, 1.f));
+        requireTexel(texels[4 * row + 1], float4(0.f, 0.f, 1.f, 1.f));
+        requireTexel(texels[4 * row + 2], float4(2 / 3.f, 0.f, 1 / 3.f, 1.f));
+        requireTexel(texels[4 * row + 3], float4(1 / 3.f, 0.f, 2 / 3.f, 1.f));
+      }
+    }
+  }
+
+  GIVEN("A BC1 block with c0 <= c1")
+  {
+    const Block block = {0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4};
+
+    THEN("BC1_RGB decodes the three color palette with opaque black")
+    {
+      auto texels = decode("BC1_RGB", block);
+      requireTexel(texels[0], float4(0.f, 0.f, 1.f, 1.f));
+      requireTexel(texels[1], float4(1.f, 0.f, 0.f, 1.f));
+      requireTexel(texels[2], float4(0.5f, 0.f, 0.5f, 1.f));
+      requireTexel(texels[3], float4(0.f, 0.f, 0.f, 1.f));
+    }
+
+    THEN("BC1_RGBA makes the fourth palette entry transparent")
+    {
+      auto texels = decode("BC1_RGBA", block);
+      requireTexel(texels[2], float4(0.5f, 0.f, 0.5f, 1.f));
+      requireTexel(texels[3], float4(0.f, 0.f, 0.f, 0.f));
+    }
+  }
+
+  GIVEN("A BC2 block with explicit alpha and c0 < c1")
+  {
+    const Block block = {0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE,
+        0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA};
+
+    THEN("Alpha is the 4-bit value and color always uses four colors")
+    {
+      auto texels = decode("BC2", block);
+      for (int i = 0; i < 16; i++)
+        requireTexel(texels[i], float4(float3(1 / 3.f), i / 15.f));
+    }
+  }
+
+  GIVEN("A BC3 block with an eight value alpha palette")
+  {
+    const Block block = {0xFF, 0x00, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00};
+
+    THEN("Alpha interpolates between a0 and a1 in sevenths")
+    {
+      constexpr float ALPHA[8] = {
+          1.f, 0.f, 6 / 7.f, 5 / 7.f, 4 / 7.f, 3 / 7.f, 2 / 7.f, 1 / 7.f};
+      auto texels = decode("BC3", block);
+      for (int i = 0; i < 16; i++)
+        requireTexel(texels[i], float4(float3(1.f), ALPHA[i % 8]));
+    }
+  }
+
+  GIVEN("A BC4 block with a six value palette")
+  {
+    const Block block = {0x00, 0xFF, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA};
+
+    THEN("Indices 6 and 7 read the fixed 0 and 1")
+    {
+      constexpr float RED[8] = {0.f, 1.f, 0.2f, 0.4f, 0.6f, 0.8f, 0.f, 1.f};
+      auto texels = decode("BC4", block);
+      for (int i = 0; i < 16; i++)
+        requireTexel(texels[i], float4(RED[i % 8], 0.f, 0.f, 1.f));
+    }
+  }
+
+  GIVEN("A BC4_SNORM block whose -128 endpoint clamps to -127")
+  {
+    const Block block = {0x80, 0x7F, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA};
+
+    THEN("Indices 6 and 7 read the fixed -1 and 1")
+    {
+      constexpr float RED[8] = {-1.f, 1.f, -0.6f, -0.2f, 0.2f, 0.6f, -1.f, 1.f};
+      auto texels = decode("BC4_SNORM", block);
+      for (int i = 0; i < 16; i++)
+        requireTexel(texels[i], float4(RED[i % 8], 0.f, 0.f, 1.f));
+    }
+  }
+
+  GIVEN("A BC5 block with constant red and green channel blocks")
+  {
+    const Block block = {
+        0x33, 0x33, 0, 0, 0, 0, 0, 0, 0xCC, 0xCC, 0, 0, 0, 0, 0, 0};
+
+    THEN("Red and green come from the first and second channel block")
+    {
+      auto texels = decode("BC5", block);
+      for (int i = 0; i < 16; i++)
+        requireTexel(texels[i], float4(0.2f, 0.8f, 0.f, 1.f));
+    }
+
+    THEN("BC5_SNORM reads the same bytes as signed values")
+    {
+      auto texels = decode("BC5_SNORM", block);
+      for (int i = 0; i < 16; i++)
+        requireTexel(texels[i], float4(51 / 127.f, -52 / 127.f, 0.f, 1.f));
+    }
+  }
+
+  GIVEN("A BC6H_UFLOAT block in mode 11 (10-bit endpoints, one region)")
+  {
+    // e0 = (495, 0, 1023), e1 = (0, 495, 0), texel i uses index i
+    const Block block = {0xE3, 0x3D, 0x00, 0xFE, 0x07, 0xE0, 0x3D, 0x00,
+        0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE};
+
+    THEN("The endpoints and an interpolated texel decode to exact halfs")
+    {
+      auto texels = decode("BC6H_UFLOAT", block);
+      requireTexelHalf(texels[0], 1.f, 0.f, 65504.f);
+      requireTexelHalf(
+          texels[7], 0.0076904296875f, 0.0040283203125f, 2.935546875f);
+      requireTexelHalf(texels[15], 0.f, 1.f, 0.f);
+    }
+  }
+
+  GIVEN("A BC6H_SFLOAT block in mode 11 with negative endpoints")
+  {
+    // e0 = (-511, 0, 511), e1 = (511, -100, -511), texel i uses index i
+    const Block block = {0x23, 0x40, 0x00, 0xFE, 0xFB, 0x8F, 0xF3, 0x00,
+        0x11, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE};
+
+    THEN("The endpoints and an interpolated texel keep their sign")
+    {
+      auto texels = decode("BC6H_SFLOAT", block);
+      requireTexelHalf(texels[0], -65504.f, 0.f, 65504.f);
+      requireTexelHalf(texels[7],
+          -0.000118255615234375f,
+          -0.00022602081298828125f,
+          0.000118255615234375f);
+      requireTexelHalf(texels[15], 65504.f, -0.0021190643310546875f, -65504.f);
+    }
+  }
+
+  GIVEN("A BC6H_UFLOAT block in mode 12 (11-bit endpoint, 9-bit deltas)")
+  {
+    // e0 = (0, 1024, 2000) and deltas (-1, 255, -256) wrap to
+    // e1 = (2047, 1279, 1744), texel 0 uses index 0 and the others index 15
+    const Block block = {0x07, 0x00, 0x00, 0xA0, 0xFF, 0xEF, 0x5F, 0x80,
+        0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+    THEN("The deltas are sign extended and added to the first endpoint")
+    {
+      auto texels = decode("BC6H_UFLOAT", block);
+      requireTexelHalf(texels[0], 0.f, 1.5068359375f, 41952.f);
+      for (int i = 1; i < 16; i++)
+        requireTexelHalf(texels[i], 65504.f, 21.875f, 2878.f);
+    }
+  }
+
+  GIVEN("BC7 blocks of the partitioned modes")
+  {
+    THEN("Mode 0 (three subsets, unique p-bits) decodes each subset")
+    {
+      requirePartitionedBC7({0x01, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
+          0x00, 0x1E, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+          3,
+          247,
+          104,
+          255);
+    }
+
+    THEN("Mode 1 (two subsets, shared p-bits) decodes each subset")
+    {
+      requirePartitionedBC7({0x02, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x00,
+          0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+          2,
+          253,
+          107,
+          255);
+    }
+
+    THEN("Mode 2 (three subsets, no p-bits) decodes each subset")
+    {
+      requirePartitionedBC7({0x04, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07,
+          0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF},
+          3,
+          255,
+          84,
+          255);
+    }
+
+    THEN("Mode 3 (two subsets, 7-bit color) decodes each subset")
+    {
+      requirePartitionedBC7({0x08, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF8,
+          0x03, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF},
+          2,
+          254,
+          83,
+          255);
+    }
+
+    THEN("Mode 7 (two subsets with alpha) decodes each subset")
+    {
+      requirePartitionedBC7({0x80, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
+          0x00, 0xFC, 0xFF, 0x3F, 0xFC, 0xFF, 0xFF, 0xFF},
+          2,
+          251,
+          82,
+          251);
+    }
+  }
+
+  GIVEN("A BC7 mode 6 block from black to white where texel i uses index i")
+  {
+    const Block block = {0x40, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0x7F,
+        0x11, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE};
+
+    THEN("Each texel reads the matching 4-bit interpolation weight")
+    {
+      constexpr int VALUES[16] = {0, 16, 36, 52, 68, 84, 104, 120, 135,
+          151, 171, 187, 203, 219, 239, 255};
+      auto texels = decode("BC7", block);
+      for (int i = 0; i < 16; i++) {
+        const int v = VALUES[i];
+        requireTexel8(texels[i], v, v, v, v);
+      }
+    }
+  }
+
+  GIVEN("A BC7 mode 4 block with rotation 1 and index selection set")
+  {
+    // color endpoints (0, 0, 0) to (31, 0, 31) and alpha 0 to 63, 2-bit
+    // indices all 1 and 3-bit indices all 2
+    const Block block = {0xB0, 0xE0, 0x03, 0x00, 0x3E, 0xF0, 0xAF, 0xAA,
+        0xAA, 0xAA, 0x94, 0x24, 0x49, 0x92, 0x24, 0x49};
+
+    THEN("Color uses the 3-bit indices and red swaps with alpha")
+    {
+      auto texels = decode("BC7", block);
+      for (int i = 0; i < 16; i++)
+        requireTexel8(texels[i], 84, 0, 72, 72);
+    }
+  }
+
+  GIVEN("A BC7 mode 5 block with rotation 3")
+  {
+    // color endpoints (0, 127, 0) to (127, 127, 0) with indices all 1, alpha
+    // 255 to 0 with texel 0 using index 1 and the others index 3
+    const Block block = {0xE0, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xFC, 0x03,
+        0xAC, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0xFF};
+
+    THEN("Blue swaps with alpha after both are interpolated")
+    {
+      auto texels = decode("BC7", block);
+      requireTexel8(texels[0], 84, 255, 171, 0);
+      for (int i = 1; i < 16; i++)
+        requireTexel8(texels[i], 84, 255, 0, 0);
+    }
+  }
+
+  GIVEN("A BC7 block with no mode bit set")
+  {
+    const Block block = {};
+
+    THEN("The reserved mode decodes to transparent black")
+    {
+      auto texels = decode("BC7", block);
+      for (int i = 0; i < 16; i++)
+        requireTexel(texels[i], float4(0.f));
+    }
+  }
+}
+
+} // namespace
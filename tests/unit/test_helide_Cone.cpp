@@ -0,0 +1,170 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+
+// helide
+#include "anari/ext/helide/anariNewHelideDevice.h"
+// anari-linalg
+#include "anari/anari_cpp/ext/linalg.h"
+
+namespace {
+
+using namespace anari::math;
+
+// A single cone or cylinder from z = -1 to z = 1 of radius 0.5, looked at
+// along its axis from a camera at (0, 0, 5)
+struct ConeScene
+{
+  ConeScene(const char *type)
+  {
+    d = anariNewHelideDevice();
+
+    geometry = anari::newObject<anari::Geometry>(d, type);
+    float3 positions[] = {{0.f, 0.f, -1.f}, {0.f, 0.f, 1.f}};
+    anari::setParameterArray1D(d, geometry, "vertex.position", positions, 2);
+    anari::setParameter(d, geometry, "radius", 0.5f);
+
+    auto material = anari::newObject<anari::Material>(d, "matte");
+    anari::commitParameters(d, material);
+
+    auto surface = anari::newObject<anari::Surface>(d);
+    anari::setParameter(d, surface, "geometry", geometry);
+    anari::setAndReleaseParameter(d, surface, "material", material);
+    anari::commitParameters(d, surface);
+
+    auto world = anari::newObject<anari::World>(d);
+    anari::setParameterArray1D(d, world, "surface", &surface, 1);
+    anari::release(d, surface);
+    anari::commitParameters(d, world);
+
+    auto camera = anari::newObject<anari::Camera>(d, "perspective");
+    anari::setParameter(d, camera, "position", float3(0.f, 0.f, 5.f));
+    anari::setParameter(d, camera, "direction", float3(0.f, 0.f, -1.f));
+    anari::setParameter(d, camera, "up", float3(0.f, 1.f, 0.f));
+    anari::commitParameters(d, camera);
+
+    auto renderer = anari::newObject<anari::Renderer>(d, "default");
+    anari::commitParameters(d, renderer);
+
+    frame = anari::newObject<anari::Frame>(d);
+    anari::setParameter(d, frame, "size", uint2(8, 8));
+    anari::setParameter(d, frame, "channel.depth", ANARI_FLOAT32);
+    anari::setAndReleaseParameter(d, frame, "world", world);
+    anari::setAndReleaseParameter(d, frame, "camera", camera);
+    anari::setAndReleaseParameter(d, frame, "renderer", renderer);
+    anari::commitParameters(d, frame);
+  }
+
+  ~ConeScene()
+  {
+    anari::release(d, frame);
+    anari::release(d, geometry);
+    anari::release(d, d);
+  }
+
+  void setCaps(const char *caps, const char *capStyle)
+  {
+    anari::setParameter(d, geometry, "caps", caps);
+    anari::setParameter(d, geometry, "capStyle", capStyle);
+    anari::commitParameters(d, geometry);
+  }
+
+  // Depth of the pixel whose ray runs along the axis
+  float axisDepth()
+  {
+    anari::render(d, frame);
+    anari::wait(d, frame);
+
+    auto fb = anari::map<float>(d, frame, "channel.depth");
+    const float depth = fb.data[(fb.height / 2) * fb.width + fb.width / 2];
+    anari::unmap(d, frame, "channel.depth");
+
+    return depth;
+  }
+
+  anari::Device d{nullptr};
+  anari::Geometry geometry{nullptr};
+  anari::Frame frame{nullptr};
+};
+
+SCENARIO("helide cylinder geometry caps", "[helide_Cone]")
+{
+  GIVEN("A cylinder viewed along its axis")
+  {
+    ConeScene scene("cylinder");
+    auto d = scene.d;
+
+    THEN("Without caps the ray passes through the open ends")
+    {
+      scene.setCaps("none", "flat");
+      REQUIRE(scene.axisDepth() > 10.f);
+    }
+
+    THEN("Flat caps on the first, second or both ends are hit")
+    {
+      scene.setCaps("first", "flat");
+      REQUIRE(scene.axisDepth() == Approx(6.f));
+      scene.setCaps("second", "flat");
+      REQUIRE(scene.axisDepth() == Approx(4.f));
+      scene.setCaps("both", "flat");
+      REQUIRE(scene.axisDepth() == Approx(4.f));
+    }
+
+    THEN("Round caps extend past the end points by the radius")
+    {
+      scene.setCaps("first", "round");
+      REQUIRE(scene.axisDepth() == Approx(6.5f));
+      scene.setCaps("both", "round");
+      REQUIRE(scene.axisDepth() == Approx(3.5f));
+    }
+
+    THEN("'primitive.radius' overrides 'radius'")
+    {
+      float radius = 0.25f;
+      anari::setParameterArray1D(
+          d, scene.geometry, "primitive.radius", &radius, 1);
+      scene.setCaps("second", "round");
+      REQUIRE(scene.axisDepth() == Approx(3.75f));
+    }
+
+    THEN("'vertex.cap' takes precedence over 'caps'")
+    {
+      uint8_t vertexCaps[] = {1, 0};
+      anari::setParameterArray1D(
+          d, scene.geometry, "vertex.cap", vertexCaps, 2);
+      scene.setCaps("second", "flat");
+      REQUIRE(scene.axisDepth() == Approx(6.f));
+    }
+  }
+}
+
+SCENARIO("helide cone geometry caps", "[helide_Cone]")
+{
+  GIVEN("A cone from radius 0.5 to 0.25 viewed along its axis")
+  {
+    ConeScene scene("cone");
+    auto d = scene.d;
+
+    float radii[] = {0.5f, 0.25f};
+    anari::setParameterArray1D(d, scene.geometry, "vertex.radius", radii, 2);
+
+    THEN("Without caps the ray passes through the open ends")
+    {
+      scene.setCaps("none", "round");
+      REQUIRE(scene.axisDepth() > 10.f);
+    }
+
+    THEN("Each end is capped with its own radius")
+    {
+      scene.setCaps("first", "round");
+      REQUIRE(scene.axisDepth() == Approx(6.5f));
+      scene.setCaps("second", "round");
+      REQUIRE(scene.axisDepth() == Approx(3.75f));
+      scene.setCaps("both", "flat");
+      REQUIRE(scene.axisDepth() == Approx(4.f));
+    }
+  }
+}
+
+} // namespace
@@ -0,0 +1,259 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+
+// helide
+#include "scene/surface/geometry/ConeIntersection.h"
+// std
+#include <limits>
+
+namespace {
+
+using namespace helide;
+
+const float3 PLUS_X(1.f, 0.f, 0.f);
+const float3 MINUS_X(-1.f, 0.f, 0.f);
+const float3 PLUS_Z(0.f, 0.f, 1.f);
+const float3 MINUS_Z(0.f, 0.f, -1.f);
+
+// A primitive along the x axis from -1 to 1
+ConePrimitive makeCone(float r0, float r1, ConeCap cap0, ConeCap cap1)
+{
+  return {float3(-1.f, 0.f, 0.f), float3(1.f, 0.f, 0.f), r0, r1, cap0, cap1};
+}
+
+bool intersect(const ConePrimitive &c,
+    const float3 &org,
+    const float3 &dir,
+    ConeHit &hit,
+    float tnear = 0.f)
+{
+  hit = {std::numeric_limits<float>::infinity(), float3(0.f), 0.f};
+  return intersectCone(c, org, dir, tnear, hit);
+}
+
+void requireNormal(const ConeHit &hit, const float3 &expected)
+{
+  const float3 n = normalize(hit.Ng);
+  REQUIRE(n.x == Approx(expected.x).margin(1e-5f));
+  REQUIRE(n.y == Approx(expected.y).margin(1e-5f));
+  REQUIRE(n.z == Approx(expected.z).margin(1e-5f));
+}
+
+SCENARIO(
+    "helide cone and cylinder ray intersection", "[helide_ConeIntersection]")
+{
+  ConeHit hit;
+
+  GIVEN("An uncapped cylinder of radius 0.5")
+  {
+    auto c = makeCone(0.5f, 0.5f, ConeCap::NONE, ConeCap::NONE);
+
+    THEN("A ray perpendicular to the axis hits the side")
+    {
+      REQUIRE(intersect(c, float3(0.f, 0.f, 5.f), MINUS_Z, hit));
+      REQUIRE(hit.t == Approx(4.5f));
+      REQUIRE(hit.u == Approx(0.5f));
+      requireNormal(hit, PLUS_Z);
+    }
+
+    THEN("A ray passing beside the cylinder misses")
+    {
+      REQUIRE(!intersect(c, float3(0.f, 1.f, 5.f), MINUS_Z, hit));
+    }
+
+    THEN("A ray beyond either end of the segment misses")
+    {
+      REQUIRE(!intersect(c, float3(1.5f, 0.f, 5.f), MINUS_Z, hit));
+      REQUIRE(!intersect(c, float3(-1.5f, 0.f, 5.f), MINUS_Z, hit));
+    }
+
+    THEN("A ray along the axis passes through the open ends")
+    {
+      REQUIRE(!intersect(c, float3(-5.f, 0.f, 0.f), PLUS_X, hit));
+    }
+
+    THEN("A ray starting inside hits the far side from within")
+    {
+      REQUIRE(intersect(c, float3(0.f), PLUS_Z, hit));
+      REQUIRE(hit.t == Approx(0.5f));
+      requireNormal(hit, PLUS_Z);
+    }
+
+    THEN("Hits closer than tnear are skipped")
+    {
+      REQUIRE(intersect(c, float3(0.f, 0.f, 5.f), MINUS_Z, hit, 5.f));
+      REQUIRE(hit.t == Approx(5.5f));
+      requireNormal(hit, MINUS_Z);
+    }
+
+    THEN("Only hits closer than the incoming hit distance are reported")
+    {
+      hit = {4.f, float3(0.f), 0.f};
+      REQUIRE(!intersectCone(c, float3(0.f, 0.f, 5.f), MINUS_Z, 0.f, hit));
+      REQUIRE(hit.t == 4.f);
+    }
+  }
+
+  GIVEN("A cylinder with a flat first cap")
+  {
+    auto c = makeCone(0.5f, 0.5f, ConeCap::FLAT, ConeCap::NONE);
+
+    THEN("A ray along the axis hits the disk facing away from the body")
+    {
+      REQUIRE(intersect(c, float3(-5.f, 0.f, 0.f), PLUS_X, hit));
+      REQUIRE(hit.t == Approx(4.f));
+      REQUIRE(hit.u == 0.f);
+      requireNormal(hit, MINUS_X);
+    }
+
+    THEN("A ray through the open second end hits the disk from inside")
+    {
+      REQUIRE(intersect(c, float3(5.f, 0.f, 0.f), MINUS_X, hit));
+      REQUIRE(hit.t == Approx(6.f));
+      requireNormal(hit, MINUS_X);
+    }
+
+    THEN("A ray parallel to the axis outside the radius misses the disk")
+    {
+      REQUIRE(!intersect(c, float3(-5.f, 0.6f, 0.f), PLUS_X, hit));
+    }
+  }
+
+  GIVEN("A cylinder with a round second cap")
+  {
+    auto c = makeCone(0.5f, 0.5f, ConeCap::NONE, ConeCap::ROUND);
+
+    THEN("A ray along the axis hits the tip of the hemisphere")
+    {
+      REQUIRE(intersect(c, float3(5.f, 0.f, 0.f), MINUS_X, hit));
+      REQUIRE(hit.t == Approx(3.5f));
+      REQUIRE(hit.u == 1.f);
+      requireNormal(hit, PLUS_X);
+    }
+
+    THEN("An off-axis ray hits the hemisphere before the end of the body")
+    {
+      REQUIRE(intersect(c, float3(5.f, 0.3f, 0.f), MINUS_X, hit));
+      REQUIRE(hit.t == Approx(3.6f));
+      requireNormal(hit, float3(0.8f, 0.6f, 0.f));
+    }
+
+    THEN("The half of the sphere inside the body is not part of the cap")
+    {
+      REQUIRE(intersect(c, float3(0.75f, 0.f, 0.f), PLUS_Z, hit));
+      REQUIRE(hit.t == Approx(0.5f));
+      REQUIRE(hit.u == Approx(0.875f));
+    }
+  }
+
+  GIVEN("A cone from radius 0.5 down to 0")
+  {
+    auto c = makeCone(0.5f, 0.f, ConeCap::FLAT, ConeCap::FLAT);
+
+    THEN("A ray perpendicular to the axis hits the side at the local radius")
+    {
+      REQUIRE(intersect(c, float3(0.f, 0.f, 5.f), MINUS_Z, hit));
+      REQUIRE(hit.t == Approx(4.75f));
+      REQUIRE(hit.u == Approx(0.5f));
+      requireNormal(hit, normalize(float3(0.25f, 0.f, 1.f)));
+    }
+
+    THEN("The zero radius end has no cap, so the ray reaches the side")
+    {
+      REQUIRE(intersect(c, float3(5.f, 0.1f, 0.f), MINUS_X, hit));
+      REQUIRE(hit.t == Approx(4.4f));
+      REQUIRE(hit.u == Approx(0.8f).margin(1e-4f));
+    }
+
+    THEN("A ray along the axis hits the flat cap of the base")
+    {
+      REQUIRE(intersect(c, float3(-5.f, 0.1f, 0.f), PLUS_X, hit));
+      REQUIRE(hit.t == Approx(4.f));
+      requireNormal(hit, MINUS_X);
+    }
+  }
+
+  GIVEN("Degenerate primitives")
+  {
+    THEN("A cylinder of radius 0 is missed by rays beside its axis")
+    {
+      auto c = makeCone(0.f, 0.f, ConeCap::ROUND, ConeCap::ROUND);
+      REQUIRE(!intersect(c, float3(0.f, 0.1f, 5.f), MINUS_Z, hit));
+      REQUIRE(!intersect(c, float3(-5.f, 0.1f, 0.f), PLUS_X, hit));
+    }
+
+    THEN("A cone whose end points coincide is never hit")
+    {
+      ConePrimitive c = {float3(0.f),
+          float3(0.f),
+          0.5f,
+          0.5f,
+          ConeCap::ROUND,
+          ConeCap::ROUND};
+      REQUIRE(!intersect(c, float3(0.f, 0.f, 5.f), MINUS_Z, hit));
+    }
+  }
+}
+
+SCENARIO("helide cone cap settings", "[helide_ConeIntersection]")
+{
+  ConeCapSettings settings;
+  ConePrimitive c{};
+
+  GIVEN("Caps set through 'caps' and 'capStyle'")
+  {
+    THEN("Each 'caps' value caps the matching ends in the chosen style")
+    {
+      settings.set("none", "round");
+      settings.apply(c, uint2(0, 1));
+      REQUIRE(c.cap0 == ConeCap::NONE);
+      REQUIRE(c.cap1 == ConeCap::NONE);
+
+      settings.set("first", "flat");
+      settings.apply(c, uint2(0, 1));
+      REQUIRE(c.cap0 == ConeCap::FLAT);
+      REQUIRE(c.cap1 == ConeCap::NONE);
+
+      settings.set("second", "round");
+      settings.apply(c, uint2(0, 1));
+      REQUIRE(c.cap0 == ConeCap::NONE);
+      REQUIRE(c.cap1 == ConeCap::ROUND);
+
+      settings.set("both", "round");
+      settings.apply(c, uint2(0, 1));
+      REQUIRE(c.cap0 == ConeCap::ROUND);
+      REQUIRE(c.cap1 == ConeCap::ROUND);
+    }
+
+    THEN("Unknown values fall back to no caps and flat caps")
+    {
+      settings.set("all", "square");
+      settings.apply(c, uint2(0, 1));
+      REQUIRE(c.cap0 == ConeCap::NONE);
+      REQUIRE(c.cap1 == ConeCap::NONE);
+      REQUIRE(settings.style == ConeCap::FLAT);
+    }
+  }
+
+  GIVEN("Per-vertex caps")
+  {
+    const uint8_t vertexCaps[] = {1, 0, 1};
+    settings.set("none", "round");
+    settings.vertexCaps = vertexCaps;
+
+    THEN("They take precedence over 'caps' and keep the 'capStyle'")
+    {
+      settings.apply(c, uint2(0, 1));
+      REQUIRE(c.cap0 == ConeCap::ROUND);
+      REQUIRE(c.cap1 == ConeCap::NONE);
+
+      settings.apply(c, uint2(1, 2));
+      REQUIRE(c.cap0 == ConeCap::NONE);
+      REQUIRE(c.cap1 == ConeCap::ROUND);
+    }
+  }
+}
+
+} // namespace
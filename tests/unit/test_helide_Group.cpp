@@ -0,0 +1,233 @@
+// Copyright 2024 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "catch.hpp"
+
+// helide
+#include "anari/ext/helide/anariNewHelideDevice.h"
+// anari-linalg
+#include "anari/anari_cpp/ext/linalg.h"
+// std
+#include <vector>
+
+namespace {
+
+using namespace anari::math;
+
+// A quad in the z = 0 plane in front of a camera at (0, 0, 2), whose surface
+// is initially left invalid so tests can fix it up after a first render
+struct QuadScene
+{
+  QuadScene()
+  {
+    d = anariNewHelideDevice();
+
+    geometry = anari::newObject<anari::Geometry>(d, "triangle");
+    commitPositions();
+
+    material = anari::newObject<anari::Material>(d, "matte");
+    anari::commitParameters(d, material);
+
+    surface = anari::newObject<anari::Surface>(d);
+    anari::setParameter(d, surface, "material", material);
+    anari::commitParameters(d, surface);
+
+    world = anari::newObject<anari::World>(d);
+    anari::setAndReleaseParameter(
+        d, world, "surface", anari::newArray1D(d, &surface));
+    anari::commitParameters(d, world);
+
+    auto camera = anari::newObject<anari::Camera>(d, "perspective");
+    anari::setParameter(d, camera, "position", float3(0.f, 0.f, 2.f));
+    anari::setParameter(d, camera, "direction", float3(0.f, 0.f, -1.f));
+    anari::setParameter(d, camera, "up", float3(0.f, 1.f, 0.f));
+    anari::commitParameters(d, camera);
+
+    auto renderer = anari::newObject<anari::Renderer>(d, "default");
+    anari::commitParameters(d, renderer);
+
+    frame = anari::newObject<anari::Frame>(d);
+    anari::setParameter(d, frame, "size", uint2(8, 8));
+    anari::setParameter(d, frame, "channel.depth", ANARI_FLOAT32);
+    anari::setParameter(d, frame, "world", world);
+    anari::setAndReleaseParameter(d, frame, "camera", camera);
+    anari::setAndReleaseParameter(d, frame, "renderer", renderer);
+    anari::commitParameters(d, frame);
+  }
+
+  ~QuadScene()
+  {
+    anari::release(d, frame);
+    anari::release(d, world);
+    anari::release(d, surface);
+    anari::release(d, material);
+    anari::release(d, geometry);
+    anari::release(d, d);
+  }
+
+  void commitPositions()
+  {
+    std::vector<float3> positions = {{-1.f, -1.f, 0.f},
+        {1.f, -1.f, 0.f},
+        {1.f, 1.f, 0.f},
+        {-1.f, -1.f, 0.f},
+        {1.f, 1.f, 0.f},
+        {-1.f, 1.f, 0.f}};
+    anari::setAndReleaseParameter(d,
+        geometry,
+        "vertex.position",
+        anari::newArray1D(d, positions.data(), positions.size()));
+    anari::commitParameters(d, geometry);
+  }
+
+  bool quadIsVisible()
+  {
+    anari::render(d, frame);
+    anari::wait(d, frame);
+
+    auto fb = anari::map<float>(d, frame, "channel.depth");
+    const float depth = fb.data[(fb.height / 2) * fb.width + fb.width / 2];
+    anari::unmap(d, frame, "channel.depth");
+
+    return depth < 10.f;
+  }
+
+  anari::Device d{nullptr};
+  anari::Geometry geometry{nullptr};
+  anari::Material material{nullptr};
+  anari::Surface surface{nullptr};
+  anari::World world{nullptr};
+  anari::Frame frame{nullptr};
+};
+
+SCENARIO("helide::Group BLS updates", "[helide_Group]")
+{
+  GIVEN("A world whose only surface has no geometry")
+  {
+    QuadScene scene;
+    auto d = scene.d;
+
+    THEN("The surface is not rendered")
+    {
+      REQUIRE(!scene.quadIsVisible());
+    }
+
+    WHEN("The geometry is set on the surface and it is committed again")
+    {
+      scene.quadIsVisible();
+      anari::setParameter(d, scene.surface, "geometry", scene.geometry);
+      anari::commitParameters(d, scene.surface);
+
+      THEN("The surface is rendered")
+      {
+        REQUIRE(scene.quadIsVisible());
+      }
+    }
+  }
+
+  GIVEN("A world whose only surface has an invalid geometry")
+  {
+    QuadScene scene;
+    auto d = scene.d;
+
+    anari::unsetParameter(d, scene.geometry, "vertex.position");
+    anari::commitParameters(d, scene.geometry);
+    anari::setParameter(d, scene.surface, "geometry", scene.geometry);
+    anari::commitParameters(d, scene.surface);
+
+    THEN("The surface is not rendered")
+    {
+      REQUIRE(!scene.quadIsVisible());
+    }
+
+    WHEN("Only the geometry is fixed and committed again")
+    {
+      scene.quadIsVisible();
+      scene.commitPositions();
+
+      THEN("The surface is rendered")
+      {
+        REQUIRE(scene.quadIsVisible());
+      }
+
+      AND_WHEN("The geometry becomes invalid again")
+      {
+        scene.quadIsVisible();
+        anari::unsetParameter(d, scene.geometry, "vertex.position");
+        anari::commitParameters(d, scene.geometry);
+
+        THEN("The surface is no longer rendered")
+        {
+          REQUIRE(!scene.quadIsVisible());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("helide::Group BLS builds with shared geometry", "[helide_Group]")
+{
+  GIVEN("Two instanced groups whose surfaces share one geometry")
+  {
+    QuadScene scene;
+    auto d = scene.d;
+
+    anari::setParameter(d, scene.surface, "geometry", scene.geometry);
+    anari::commitParameters(d, scene.surface);
+
+    auto surface2 = anari::newObject<anari::Surface>(d);
+    anari::setParameter(d, surface2, "geometry", scene.geometry);
+    anari::setParameter(d, surface2, "material", scene.material);
+    anari::commitParameters(d, surface2);
+
+    // two small quads left and right of the view axis
+    std::vector<anari::Instance> instances;
+    for (auto *s : {&scene.surface, &surface2}) {
+      auto group = anari::newObject<anari::Group>(d);
+      anari::setAndReleaseParameter(
+          d, group, "surface", anari::newArray1D(d, s));
+      anari::commitParameters(d, group);
+
+      const float x = instances.empty() ? -0.5f : 0.5f;
+      const mat4 xfm = {{0.4f, 0.f, 0.f, 0.f},
+          {0.f, 0.4f, 0.f, 0.f},
+          {0.f, 0.f, 1.f, 0.f},
+          {x, 0.f, 0.f, 1.f}};
+      auto inst = anari::newObject<anari::Instance>(d, "transform");
+      anari::setAndReleaseParameter(d, inst, "group", group);
+      anari::setParameter(d, inst, "transform", xfm);
+      anari::commitParameters(d, inst);
+      instances.push_back(inst);
+    }
+
+    anari::unsetParameter(d, scene.world, "surface");
+    anari::setAndReleaseParameter(d,
+        scene.world,
+        "instance",
+        anari::newArray1D(d, instances.data(), instances.size()));
+    anari::commitParameters(d, scene.world);
+
+    for (auto inst : instances)
+      anari::release(d, inst);
+    anari::release(d, surface2);
+
+    THEN("Both instances are rendered")
+    {
+      anari::render(d, scene.frame);
+      anari::wait(d, scene.frame);
+
+      auto fb = anari::map<float>(d, scene.frame, "channel.depth");
+      const uint32_t row = (fb.height / 2) * fb.width;
+      const float left = fb.data[row + fb.width / 4];
+      const float center = fb.data[row + fb.width / 2];
+      const float right = fb.data[row + 3 * fb.width / 4];
+      anari::unmap(d, scene.frame, "channel.depth");
+
+      REQUIRE(left < 10.f);
+      REQUIRE(center > 10.f);
+      REQUIRE(right < 10.f);
+    }
+  }
+}
+
+} // namespace